@@ -0,0 +1,102 @@
+/**
+* \file      FixedSizeBenchmark.cpp
+* \author    m.leclech
+* \version   1.0
+* \date      19 October 2026
+* \brief     Benchmark of the schemes specialized on the number of space steps.
+*
+* \details   For each scheme, the problem of the assigment (s = 20) is solved many
+*            times with the generic solve methods and with the specialized ones,
+*            and the number of solves per second and the difference between the
+*            solutions are printed. The DuFort-Frankel scheme is also solved with
+*            HeatConduction::set_fast_division, which is not identical to the last bit.
+*            It is a separate program, built for example with :
+*            g++ -std=c++11 -O2 FixedSizeBenchmark.cpp FixedSizeSchemes.cpp HeatConduction.cpp -o FixedSizeBenchmark
+*/
+
+#include "HeatConduction.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+
+typedef std::chrono::high_resolution_clock Clock;
+
+/**
+* \fn double solves_per_second(HeatConduction &problem, std::vector<double> initial, int iterations)
+* \brief Solve the same problem many times, from the same initial solution
+*
+* \param problem - the problem to solve
+* \param initial - the solution set before each solve, used by the implicit schemes
+* \param iterations - the number of solves
+* \return rate - the number of solves per second
+*/
+double solves_per_second(HeatConduction &problem, std::vector<double> initial, int iterations){
+	auto t1 = Clock::now();
+	for (int i = 0; i < iterations; i++){
+		problem.set_u_n(initial);
+		problem.solve();
+	}
+	auto t2 = Clock::now();
+	return iterations / (std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count() * 1e-9);
+}
+
+/**
+* \fn int main(int argc, char *argv[])
+* \brief Run the benchmark
+*
+* \param argc - number of arguments
+* \param argv - [number of solves] [dx] [Tend]
+* \return 0 - return a 0 if everything went ok.
+*/
+int main(int argc, char *argv[]){
+	int iterations = argc > 1 ? atoi(argv[1]) : 20000;
+	double dx = argc > 2 ? atof(argv[2]) : 0.05;
+	double Tend = argc > 3 ? atof(argv[3]) : 0.5;
+	const char *names[5] = { "Analytical", "DuFort_Frankel", "Richardson", "Laasonen", "CrankNicholson" };
+
+	std::cout << "Benchmark: " << iterations << " solves, dx = " << dx << ", Tend = " << Tend << std::endl;
+	for (int scheme = DUFORT_FRANKEL; scheme <= CRANK_NICHOLSON; scheme++){
+		HeatConduction *problem = create_problem(scheme, 100, 300, 0, 1, Tend, 0.1, dx, 0.01);
+		std::vector<double> initial = (*problem).get_u_n();
+
+		HeatConduction::set_fixed_size(false);
+		double generic = solves_per_second(*problem, initial, iterations);
+		std::vector<double> solutionGeneric = (*problem).get_u_n();
+
+		HeatConduction::set_fixed_size(true);
+		double fixed = solves_per_second(*problem, initial, iterations);
+		std::vector<double> solutionFixed = (*problem).get_u_n();
+
+		double difference = 0;
+		for (int i = 0; i < int(solutionFixed.size()); i++){
+			difference = std::max(difference, std::fabs(solutionFixed[i] - solutionGeneric[i]));
+		}
+
+		std::cout << std::left << std::setw(16) << names[scheme] << std::right << std::fixed << std::setprecision(0);
+		std::cout << " generic " << std::setw(10) << generic << " solves/s // fixed " << std::setw(10) << fixed << " solves/s";
+		std::cout << std::setprecision(1) << " // x" << fixed / generic;
+		std::cout << std::scientific << std::setprecision(1) << " // max difference " << difference << std::endl;
+
+		if (scheme == DUFORT_FRANKEL){
+			// the choice is kept by the objects, so a new one is created
+			HeatConduction::set_fast_division(true);
+			HeatConduction *problemFast = create_problem(scheme, 100, 300, 0, 1, Tend, 0.1, dx, 0.01);
+			HeatConduction::set_fast_division(false);
+			double fast = solves_per_second(*problemFast, initial, iterations);
+			std::vector<double> solutionFast = (*problemFast).get_u_n();
+			delete problemFast;
+			double fastDifference = 0;
+			for (int i = 0; i < int(solutionFast.size()); i++){
+				fastDifference = std::max(fastDifference, std::fabs(solutionFast[i] - solutionFixed[i]));
+			}
+			std::cout << std::left << std::setw(16) << "  fast division" << std::right << std::fixed << std::setprecision(0);
+			std::cout << "                            // fixed " << std::setw(10) << fast << " solves/s";
+			std::cout << std::setprecision(1) << " // x" << fast / fixed;
+			std::cout << std::scientific << std::setprecision(1) << " // max difference " << fastDifference << std::endl;
+		}
+		delete problem;
+	}
+	return 0;
+}
@@ -0,0 +1,46 @@
+/**
+* \file      FixedSizeSchemes.cpp
+* \author    m.leclech
+* \version   1.0
+* \date      19 October 2026
+* \brief     Schemes specialized at compile time on the number of space steps.
+*
+* \details   The specializations are made for the usual grids of a 1 ft wall :
+*            dx = 0.1, 0.05 (the assigment), 0.025, 0.02 and 0.01.
+*/
+
+#include "FixedSizeSchemes.h"
+
+/**
+* \fn bool solve_fixed_size(int scheme, int s, int n, double r, double Text_0, bool fastDivision, std::vector<double> &u_nminus1, std::vector<double> &u_n)
+* \brief Dispatcher which pick the specialization corresponding to s, to march n time steps
+*
+* \param scheme - a value of the enum Scheme
+* \param s - the number of space steps
+* \param n - the number of time steps
+* \param r - D*dt/(dx*dx)
+* \param Text_0 - initial condition Temperature outside
+* \param fastDivision - true to multiply by 1/(1+2r) in the DuFort-Frankel scheme
+* \param u_nminus1 - vector of size s+1, the solution before the start for the explicit schemes, replaced by the one before the end
+* \param u_n - vector of size s+1, the solution at the start, replaced by the solution at the end
+* \return solved - false if there is no specialization, then the generic solve has to be used
+*/
+bool solve_fixed_size(int scheme, int s, int n, double r, double Text_0, bool fastDivision, std::vector<double> &u_nminus1, std::vector<double> &u_n){
+	if (int(u_n.size()) != s + 1 || int(u_nminus1.size()) != s + 1){
+		return false;
+	}
+	switch (s){
+	case 10:
+		return fixed_solve<10>(scheme, n, r, Text_0, fastDivision, u_nminus1, u_n);
+	case 20:
+		return fixed_solve<20>(scheme, n, r, Text_0, fastDivision, u_nminus1, u_n);
+	case 40:
+		return fixed_solve<40>(scheme, n, r, Text_0, fastDivision, u_nminus1, u_n);
+	case 50:
+		return fixed_solve<50>(scheme, n, r, Text_0, fastDivision, u_nminus1, u_n);
+	case 100:
+		return fixed_solve<100>(scheme, n, r, Text_0, fastDivision, u_nminus1, u_n);
+	default:
+		return false;
+	}
+}
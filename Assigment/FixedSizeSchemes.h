@@ -0,0 +1,195 @@
+/**
+* \file      FixedSizeSchemes.h
+* \author    m.leclech
+* \version   1.0
+* \date      19 October 2026
+* \brief     Schemes specialized at compile time on the number of space steps.
+*
+* \details   For the small grids (s = 20 in the assigment) the vectors of the
+*            HeatConduction classes and their sizes read from the attributes cost
+*            more than the calculation. These versions use std::array of size S+1,
+*            so the compiler know all the loop bounds, and they avoid the copies of
+*            the vectors at each time step. Like the march methods of the classes they
+*            continue from the solutions given, u_nminus1 and u_n for the explicit
+*            schemes and u_n for the implicit ones, and give back the same vectors. The scheme is also a template parameter,
+*            so there is no test on it in the loops. The calculations are made in the
+*            same order as the classes, so the results are identical to the last bit
+*            and the solutions in a ResultCache do not depend on the path used. The
+*            dispatcher solve_fixed_size pick a specialization from the values of s
+*            and of the scheme at runtime, and the classes fall back on their own
+*            solve otherwise.
+*/
+
+#pragma once
+
+#include "HeatConduction.h"
+#include <array>
+#include <vector>
+
+/**
+* \fn void fixed_explicit(int n, double r, double Text_0, std::array<double, S + 1> &u_nminus1, std::array<double, S + 1> &u_n)
+* \brief DuFort_Frankel or Richardson scheme (SCHEME) on S space steps, like ExplicitMethod::march
+*
+* With FAST_DIVISION the DuFort-Frankel scheme multiply by 1/(1+2r) instead of
+* dividing by 1+2r, like DuFort_Frankel::advance with HeatConduction::set_fast_division.
+*
+* \param n - the number of time steps
+* \param r - D*dt/(dx*dx)
+* \param Text_0 - initial condition Temperature outside
+* \param u_nminus1 - the solution before the start, replaced by the one before the end
+* \param u_n - the solution at the start, replaced by the solution at the end
+* \return void
+*/
+template <int S, int SCHEME, bool FAST_DIVISION>
+void fixed_explicit(int n, double r, double Text_0, std::array<double, S + 1> &u_nminus1, std::array<double, S + 1> &u_n){
+	const double inverse = 1 / (1 + 2 * r); // only used with FAST_DIVISION
+	std::array<double, S + 1> next;
+	double *u_old = u_nminus1.data(); // u_nminus1, u_n and u_nplus1 turn at each time step instead of being copied
+	double *u_now = u_n.data();
+	double *u_nplus1 = next.data();
+
+	/* Calculte n = 1 and so on, SCHEME and FAST_DIVISION are constants so the compiler keep one loop */
+	for (int j = 1; j < n + 1; j++){
+		u_nplus1[0] = Text_0; //boundaries conditions
+		u_nplus1[S] = Text_0; //boundaries conditions
+		if (SCHEME == DUFORT_FRANKEL && FAST_DIVISION){
+			for (int i = 1; i < S; i++){
+				u_nplus1[i] = (u_old[i] + 2 * r*(u_now[i + 1] - u_old[i] + u_now[i - 1])) * inverse;
+			}
+		}
+		else if (SCHEME == DUFORT_FRANKEL){
+			for (int i = 1; i < S; i++){
+				u_nplus1[i] = (u_old[i] + 2 * r*(u_now[i + 1] - u_old[i] + u_now[i - 1])) / (1 + 2 * r);
+			}
+		}
+		else {
+			for (int i = 1; i < S; i++){
+				u_nplus1[i] = u_old[i] + 2 * r * (u_now[i + 1] - (2 * u_now[i] + u_now[i - 1]));
+			}
+		}
+		double *oldest = u_old;
+		u_old = u_now;
+		u_now = u_nplus1;
+		u_nplus1 = oldest;
+	}
+
+	// the buffers have turned, so the solutions are copied back in u_nminus1 and u_n
+	std::array<double, S + 1> before;
+	std::array<double, S + 1> last;
+	for (int i = 0; i < S + 1; i++){
+		before[i] = u_old[i];
+		last[i] = u_now[i];
+	}
+	u_nminus1 = before;
+	u_n = last;
+}
+
+/**
+* \fn void fixed_implicit(int n, double r, double Text_0, std::array<double, S + 1> &u_n)
+* \brief Laasonen or Crank-Nicholson scheme (SCHEME) on S space steps, like their solve and ImplicitMethod::ThomasAlgorith
+*
+* The matrix is the same at each time step, so the forward elimination of the
+* matrix (m and b) is made once, and only d is eliminated at each time step.
+*
+* \param n - the number of time steps
+* \param r - D*dt/(dx*dx)
+* \param Text_0 - initial condition Temperature outside
+* \param u_n - the solution at the start, replaced by the solution at the end
+* \return void
+*/
+template <int S, int SCHEME>
+void fixed_implicit(int n, double r, double Text_0, std::array<double, S + 1> &u_n){
+	const bool laasonen = (SCHEME == LAASONEN); // a constant, so the compiler keep one loop
+	const double offDiagonal = laasonen ? -r : -r / 2; // a and c
+	const double boundary = laasonen ? Text_0 * r : Text_0 * (r / 2);
+	std::array<double, S - 1> m; // var needed in the Thomas Algorithm
+	std::array<double, S - 1> b; // middle tridiagonal vector of the matrix, once eliminated
+	std::array<double, S - 1> d; // vector on the right of the equation
+
+	//Forward elimination phase of the matrix
+	b[0] = laasonen ? 2 * r + 1 : r + 1;
+	for (int k = 1; k < S - 1; k++){
+		m[k] = offDiagonal / b[k - 1];
+		b[k] = b[0] - (m[k] * offDiagonal);
+	}
+
+	for (int j = 1; j < n + 1; j++){
+		if (laasonen){
+			for (int i = 0; i < S - 1; i++){
+				d[i] = u_n[i + 1];
+			}
+		}
+		else {
+			for (int i = 0; i < S - 1; i++){
+				d[i] = (r / 2)*u_n[i + 2] + (1 - r)*u_n[i + 1] + (r / 2)*u_n[i];
+			}
+		}
+		//Boundaries conditions
+		d[0] += boundary;
+		d[S - 2] += boundary;
+
+		//Forward elimination phase of d
+		for (int k = 1; k < S - 1; k++){
+			d[k] = d[k] - (m[k] * d[k - 1]);
+		}
+
+		//Backward elimination phase
+		u_n[S] = Text_0;
+		u_n[0] = Text_0;
+		u_n[S - 1] = d[S - 2] / b[S - 2];
+		for (int k = S - 3; k > -1; k--){
+			u_n[k + 1] = (d[k] - (offDiagonal * u_n[k + 2])) / b[k];
+		}
+	}
+}
+
+/**
+* \fn bool fixed_solve(int scheme, int n, double r, double Text_0, bool fastDivision, std::vector<double> &u_nminus1, std::vector<double> &u_n)
+* \brief March one of the 4 schemes on S space steps, the scheme is tested once here
+*
+* \param scheme - a value of the enum Scheme, except ANALYTICAL
+* \param n - the number of time steps
+* \param r - D*dt/(dx*dx)
+* \param Text_0 - initial condition Temperature outside
+* \param fastDivision - true to multiply by 1/(1+2r) in the DuFort-Frankel scheme, see HeatConduction::set_fast_division
+* \param u_nminus1 - vector of size S+1, the solution before the start for the explicit schemes, replaced by the one before the end
+* \param u_n - vector of size S+1, the solution at the start, replaced by the solution at the end
+* \return solved - false if the scheme is not a finite difference scheme
+*/
+template <int S>
+bool fixed_solve(int scheme, int n, double r, double Text_0, bool fastDivision, std::vector<double> &u_nminus1, std::vector<double> &u_n){
+	std::array<double, S + 1> previous;
+	std::array<double, S + 1> u;
+	for (int i = 0; i < S + 1; i++){
+		previous[i] = u_nminus1[i];
+		u[i] = u_n[i];
+	}
+	switch (scheme){
+	case DUFORT_FRANKEL:
+		if (fastDivision){
+			fixed_explicit<S, DUFORT_FRANKEL, true>(n, r, Text_0, previous, u);
+		}
+		else {
+			fixed_explicit<S, DUFORT_FRANKEL, false>(n, r, Text_0, previous, u);
+		}
+		break;
+	case RICHARDSON:
+		fixed_explicit<S, RICHARDSON, false>(n, r, Text_0, previous, u);
+		break;
+	case LAASONEN:
+		fixed_implicit<S, LAASONEN>(n, r, Text_0, u);
+		break;
+	case CRANK_NICHOLSON:
+		fixed_implicit<S, CRANK_NICHOLSON>(n, r, Text_0, u);
+		break;
+	default:
+		return false;
+	}
+	for (int i = 0; i < S + 1; i++){
+		u_nminus1[i] = previous[i];
+		u_n[i] = u[i];
+	}
+	return true;
+}
+
+bool solve_fixed_size(int scheme, int s, int n, double r, double Text_0, bool fastDivision, std::vector<double> &u_nminus1, std::vector<double> &u_n);
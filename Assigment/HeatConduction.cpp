@@ -14,10 +14,16 @@
 */
 
 #include "HeatConduction.h"
+#include "FixedSizeSchemes.h"
 #include <cmath>
+#include <sstream>
+#include <iomanip>
 
 const double pi = atan(1) * 4; //!< define pi
 
+std::atomic<bool> HeatConduction::fixedSize(true);
+std::atomic<bool> HeatConduction::fastDivision(false);
+
 //
 // ...... BASE CLASS ......
 //
@@ -52,8 +58,15 @@ HeatConduction::HeatConduction(double Tin_0, double Text_0, double Xmin, double
 	u_nplus1 = std::vector<double>(s+1);
 	u_n = std::vector<double>(s+1);
 	u_nminus1 = std::vector<double>(s+1);
+	modified = false;
 }
 
+/**
+* \fn HeatConduction::~HeatConduction()
+* \brief Virtual destructor, so the sub classes are freed through a HeatConduction pointer
+*/
+HeatConduction::~HeatConduction() {}
+
 /**
 * \fn void HeatConduction::solve()
 * \brief Abstract solve
@@ -62,6 +75,61 @@ HeatConduction::HeatConduction(double Tin_0, double Text_0, double Xmin, double
 */
 void HeatConduction::solve() {}
 
+/**
+* \fn void HeatConduction::set_parameters(double Tin_0, double Text_0, double Xmin, double Xmax, double Tend, double D, double dx, double dt)
+* \brief Change the parameters of the problem, so the object and its vectors can be used again
+*
+* The vectors are only reallocated if the number of space steps change. The
+* solution is not initialised, initialise has to be called before march.
+*
+* \param Tin_0 - initial condition Temperature inside
+* \param Text_0 - initial condition Temperature outside
+* \param Xmin - the X position far left
+* \param Xmax - the X position far right
+* \param Tend - the end time of the simulation
+* \param D - the difusivity of the wall
+* \param dx - the space step
+* \param dt - the time step
+* \return void
+*/
+void HeatConduction::set_parameters(double Tin_0, double Text_0, double Xmin, double Xmax, double Tend, double D, double dx, double dt){
+	this->Tin_0 = Tin_0;
+	this->Text_0 = Text_0;
+	this->Xmin = Xmin;
+	this->Xmax = Xmax;
+	this->Tend = Tend;
+	this->D = D;
+	this->dx = dx;
+	this->dt = dt;
+
+	r = (D*dt) / (dx*dx);
+	n = int(Tend / dt);
+	s = int((Xmax - Xmin) / dx);
+
+	if (int(u_n.size()) != s + 1){
+		u_nplus1 = std::vector<double>(s + 1);
+		u_n = std::vector<double>(s + 1);
+		u_nminus1 = std::vector<double>(s + 1);
+	}
+}
+
+/**
+* \fn void HeatConduction::initialise()
+* \brief Abstract initialisation of the solution at t = 0
+*
+* \return void - the result is stored in the vector u_n of the mother Class
+*/
+void HeatConduction::initialise() {}
+
+/**
+* \fn void HeatConduction::march(int steps)
+* \brief Abstract march : continue the solution from its current time by a number of time steps
+*
+* \param steps - the number of time steps
+* \return void - the result is stored in the vector u_n of the mother Class
+*/
+void HeatConduction::march(int steps) {}
+
 /**
 * \fn std::vector<double> HeatConduction::get_u_n() const
 * \brief Get method of the attribute u_n
@@ -72,6 +140,245 @@ std::vector<double> HeatConduction::get_u_n() const {
 	return u_n;
 }
 
+/**
+* \fn const std::vector<double>& HeatConduction::get_u_n_view() const
+* \brief Get method of the attribute u_n, without copy
+*
+* The vector keep the same size and storage for the life of the object, so the
+* reference stay valid and show the solution after each call to solve.
+*
+* \return u_n - a reference to the vector attribute of the mother Class
+*/
+const std::vector<double>& HeatConduction::get_u_n_view() const {
+	return u_n;
+}
+
+/**
+* \fn void HeatConduction::set_u_n(std::vector<double> u_n)
+* \brief Set method of the attribute u_n
+*
+* The problem is marked as modified until the next initialisation, because an
+* implicit scheme continue from this solution and the key does not describe it.
+*
+* \param u_n - a solution vector of size s+1, e.g. restored from a ResultCache
+* \return void - the vector is stored in the attribute u_n of the mother Class
+*/
+void HeatConduction::set_u_n(std::vector<double> u_n) {
+	this->u_n = u_n;
+	modified = true;
+}
+
+/**
+* \fn void HeatConduction::restore_u_n(const std::vector<double> &u_n)
+* \brief Set the solution of the problem described by the key, e.g. found in a ResultCache
+*
+* Unlike set_u_n the problem is not marked as modified, so it is in the same state as
+* after an initialisation and a solve.
+*
+* \param u_n - the solution vector of size s+1
+* \return void - the vector is stored in the attribute u_n of the mother Class
+*/
+void HeatConduction::restore_u_n(const std::vector<double> &u_n) {
+	this->u_n = u_n;
+	modified = false;
+}
+
+/**
+* \fn bool HeatConduction::is_modified() const
+* \brief Get method of the attribute modified
+*
+* \return modified - true if u_n was given by set_u_n since the last initialisation
+*/
+bool HeatConduction::is_modified() const {
+	return modified;
+}
+
+/**
+* \fn double HeatConduction::get_Tin_0() const
+* \brief Get method of the attribute Tin_0
+*
+* \return Tin_0 - initial condition Temperature inside
+*/
+double HeatConduction::get_Tin_0() const {
+	return Tin_0;
+}
+
+/**
+* \fn double HeatConduction::get_Text_0() const
+* \brief Get method of the attribute Text_0
+*
+* \return Text_0 - initial condition Temperature outside
+*/
+double HeatConduction::get_Text_0() const {
+	return Text_0;
+}
+
+/**
+* \fn double HeatConduction::get_Xmin() const
+* \brief Get method of the attribute Xmin
+*
+* \return Xmin - the X position far left
+*/
+double HeatConduction::get_Xmin() const {
+	return Xmin;
+}
+
+/**
+* \fn double HeatConduction::get_Xmax() const
+* \brief Get method of the attribute Xmax
+*
+* \return Xmax - the X position far right
+*/
+double HeatConduction::get_Xmax() const {
+	return Xmax;
+}
+
+/**
+* \fn double HeatConduction::get_Tend() const
+* \brief Get method of the attribute Tend
+*
+* \return Tend - the end time of the simulation
+*/
+double HeatConduction::get_Tend() const {
+	return Tend;
+}
+
+/**
+* \fn double HeatConduction::get_D() const
+* \brief Get method of the attribute D
+*
+* \return D - the difusivity of the wall
+*/
+double HeatConduction::get_D() const {
+	return D;
+}
+
+/**
+* \fn double HeatConduction::get_dx() const
+* \brief Get method of the attribute dx
+*
+* \return dx - the space step
+*/
+double HeatConduction::get_dx() const {
+	return dx;
+}
+
+/**
+* \fn double HeatConduction::get_dt() const
+* \brief Get method of the attribute dt
+*
+* \return dt - the time step
+*/
+double HeatConduction::get_dt() const {
+	return dt;
+}
+
+/**
+* \fn int HeatConduction::get_n() const
+* \brief Get method of the attribute n
+*
+* \return n - the number of time steps
+*/
+int HeatConduction::get_n() const {
+	return n;
+}
+
+/**
+* \fn int HeatConduction::get_s() const
+* \brief Get method of the attribute s
+*
+* \return s - the number of space steps
+*/
+int HeatConduction::get_s() const {
+	return s;
+}
+
+/**
+* \fn double HeatConduction::get_r() const
+* \brief Get method of the attribute r
+*
+* \return r - D*dt/(dx*dx)
+*/
+double HeatConduction::get_r() const {
+	return r;
+}
+
+/**
+* \fn void HeatConduction::set_fixed_size(bool fixedSize)
+* \brief Choose if the schemes specialized on the number of space steps are used
+*
+* The results are identical either way, so it can be changed while other threads
+* are solving : each march read it once.
+*
+* \param fixedSize - false to always use the generic solve methods, e.g. to compare them
+* \return void
+*/
+void HeatConduction::set_fixed_size(bool fixedSize) {
+	HeatConduction::fixedSize = fixedSize;
+}
+
+/**
+* \fn bool HeatConduction::get_fixed_size()
+* \brief Get method of the static attribute fixedSize
+*
+* \return fixedSize - true if the specialized schemes are used
+*/
+bool HeatConduction::get_fixed_size() {
+	return fixedSize;
+}
+
+/**
+* \fn void HeatConduction::set_fast_division(bool fastDivision)
+* \brief Choose if the DuFort-Frankel scheme multiply by 1/(1+2r) instead of dividing by 1+2r
+*
+* The multiplication is faster but its rounding is not the one of the division,
+* so the solutions change in the last bits and their keys are not the same. The
+* choice is read when a DuFort_Frankel object is created and kept by the object,
+* so the threads which are solving are not affected.
+*
+* \param fastDivision - true to multiply in the objects created after, false (the default) to divide
+* \return void
+*/
+void HeatConduction::set_fast_division(bool fastDivision) {
+	HeatConduction::fastDivision = fastDivision;
+}
+
+/**
+* \fn bool HeatConduction::get_fast_division()
+* \brief Get method of the static attribute fastDivision
+*
+* \return fastDivision - true if the DuFort_Frankel objects created now multiply by 1/(1+2r)
+*/
+bool HeatConduction::get_fast_division() {
+	return fastDivision;
+}
+
+/**
+* \fn std::string HeatConduction::get_scheme() const
+* \brief Name of the scheme, the same used in the name of the output files
+*
+* \return scheme - the name of the scheme
+*/
+std::string HeatConduction::get_scheme() const {
+	return "HeatConduction";
+}
+
+/**
+* \fn std::string HeatConduction::get_key() const
+* \brief Key which identify the problem, made of the scheme and all the parameters
+*
+* Two objects with the same key give the same solution, so the key can be used
+* to store and find back a solution in a ResultCache.
+*
+* \return key - the scheme followed by all the parameters at full precision
+*/
+std::string HeatConduction::get_key() const {
+	std::ostringstream key;
+	key << std::setprecision(17);
+	key << get_scheme() << " " << Tin_0 << " " << Text_0 << " " << Xmin << " " << Xmax << " " << Tend << " " << D << " " << dx << " " << dt;
+	return key.str();
+}
+
 //
 // ...... SUB CLASS ......
 //
@@ -110,6 +417,30 @@ void AnalyticalSolution::solve(){
 	}
 }
 
+/**
+* \fn std::string AnalyticalSolution::get_scheme() const
+* \brief Name of the scheme
+*
+* \return scheme - the name of the scheme
+*/
+std::string AnalyticalSolution::get_scheme() const {
+	return "Analytical";
+}
+
+/**
+* \fn std::string AnalyticalSolution::get_key() const
+* \brief Key which identify the problem. The time step is not used by the
+* analytical solution, so it is left out of the key.
+*
+* \return key - the scheme followed by the parameters at full precision
+*/
+std::string AnalyticalSolution::get_key() const {
+	std::ostringstream key;
+	key << std::setprecision(17);
+	key << get_scheme() << " " << Tin_0 << " " << Text_0 << " " << Xmin << " " << Xmax << " " << Tend << " " << D << " " << dx;
+	return key.str();
+}
+
 /**
 * \fn ExplicitMethod::ExplicitMethod(double Tin_0, double Text_0, double Xmin, double Xmax, double Tend, double D, double dx, double dt)
 * \brief Constructor of the ExplicitMethod class
@@ -141,6 +472,17 @@ void ExplicitMethod::advance(int i){}
 * \return void - the result is stored in the vector u_n of the mother Class
 */
 void ExplicitMethod::solve(){
+	initialise();
+	march(n);
+}
+
+/**
+* \fn void ExplicitMethod::initialise()
+* \brief Initialisation of the solutions n = -1 and n = 0
+*
+* \return void - the result is stored in the vectors u_nminus1 and u_n of the mother Class
+*/
+void ExplicitMethod::initialise(){
 	/* initialisation n = -1 and n = 0 */
 	for (int i = 0; i < s + 1; i++){
 		u_nminus1[i] = Tin_0;
@@ -148,9 +490,19 @@ void ExplicitMethod::solve(){
 	}
 	u_n[0] = Text_0;
 	u_n[s] = Text_0;
+	modified = false;
+}
 
+/**
+* \fn void ExplicitMethod::march(int steps)
+* \brief Continue the solution by a number of time steps, from u_nminus1 and u_n
+*
+* \param steps - the number of time steps
+* \return void - the result is stored in the vector u_n of the mother Class
+*/
+void ExplicitMethod::march(int steps){
 	/* Calculte n = 1 and so on */
-	for (int j = 1; j < n + 1; j++){
+	for (int j = 1; j < steps + 1; j++){
 		u_nplus1[0] = Text_0; //boundaries conditions
 		u_nplus1[s] = Text_0; //boundaries conditions
 		for (int i = 1; i < s; i++){
@@ -197,6 +549,45 @@ ImplicitMethod::ImplicitMethod(double Tin_0, double Text_0, double Xmin, double
 */
 void ImplicitMethod::solve() {}
 
+/**
+* \fn void ImplicitMethod::set_parameters(double Tin_0, double Text_0, double Xmin, double Xmax, double Tend, double D, double dx, double dt)
+* \brief Change the parameters of the problem, and the size of the matrix if the number of space steps change
+*
+* \param Tin_0 - initial condition Temperature inside
+* \param Text_0 - initial condition Temperature outside
+* \param Xmin - the X position far left
+* \param Xmax - the X position far right
+* \param Tend - the end time of the simulation
+* \param D - the difusivity of the wall
+* \param dx - the space step
+* \param dt - the time step
+* \return void
+*/
+void ImplicitMethod::set_parameters(double Tin_0, double Text_0, double Xmin, double Xmax, double Tend, double D, double dx, double dt){
+	HeatConduction::set_parameters(Tin_0, Text_0, Xmin, Xmax, Tend, D, dx, dt);
+	if (int(d.size()) != s - 1){
+		a = std::vector<double>(s - 1);
+		b = std::vector<double>(s - 1);
+		c = std::vector<double>(s - 1);
+		d = std::vector<double>(s - 1);
+	}
+}
+
+/**
+* \fn void ImplicitMethod::initialise()
+* \brief Initialisation of the solution n = 0
+*
+* \return void - the result is stored in the vector u_n of the mother Class
+*/
+void ImplicitMethod::initialise(){
+	for (int i = 1; i < s; i++){
+		u_n[i] = Tin_0;
+	}
+	u_n[0] = Text_0;
+	u_n[s] = Text_0;
+	modified = false;
+}
+
 /**
 * \fn void ImplicitMethod::ThomasAlgorith()
 * \brief The Thomas Algorith, to solve Tridiagonal matrix problem
@@ -239,7 +630,35 @@ void ImplicitMethod::ThomasAlgorith() {
 * \param dx - the space step
 * \param dt - the time step
 */
-DuFort_Frankel::DuFort_Frankel(double Tin_0, double Text_0, double Xmin, double Xmax, double Tend, double D, double dx, double dt) : ExplicitMethod(Tin_0, Text_0, Xmin, Xmax, Tend, D, dx, dt) {}
+DuFort_Frankel::DuFort_Frankel(double Tin_0, double Text_0, double Xmin, double Xmax, double Tend, double D, double dx, double dt) : ExplicitMethod(Tin_0, Text_0, Xmin, Xmax, Tend, D, dx, dt) {
+	inverse = 1 / (1 + 2*r);
+	fast = fastDivision;
+}
+
+/**
+* \fn void DuFort_Frankel::initialise()
+* \brief Initialisation of ExplicitMethod, and of 1/(1+2r) which depend on the parameters
+*
+* \return void - the result is stored in the vectors u_nminus1 and u_n of the mother Class
+*/
+void DuFort_Frankel::initialise(){
+	ExplicitMethod::initialise();
+	inverse = 1 / (1 + 2*r);
+}
+
+/**
+* \fn void DuFort_Frankel::march(int steps)
+* \brief March with the scheme specialized on s if there is one, or with ExplicitMethod::march
+*
+* \param steps - the number of time steps
+* \return void - the result is stored in the vectors u_nminus1 and u_n of the mother Class
+*/
+void DuFort_Frankel::march(int steps){
+	if (fixedSize && solve_fixed_size(DUFORT_FRANKEL, s, steps, r, Text_0, fast, u_nminus1, u_n)){
+		return;
+	}
+	ExplicitMethod::march(steps);
+}
 
 /**
 * \fn DuFort_Frankel::advance(int i)
@@ -249,7 +668,36 @@ DuFort_Frankel::DuFort_Frankel(double Tin_0, double Text_0, double Xmin, double
 * \return void - the result is stored in the vector u_nplus1 of the mother Class
 */
 void DuFort_Frankel::advance(int i){	
-	u_nplus1[i] = (u_nminus1[i] + 2*r*(u_n[i+1] - u_nminus1[i] + u_n[i-1])) /  (1 + 2*r);
+	if (fast){
+		u_nplus1[i] = (u_nminus1[i] + 2*r*(u_n[i+1] - u_nminus1[i] + u_n[i-1])) * inverse;
+	}
+	else {
+		u_nplus1[i] = (u_nminus1[i] + 2*r*(u_n[i+1] - u_nminus1[i] + u_n[i-1])) /  (1 + 2*r);
+	}
+}
+
+/**
+* \fn std::string DuFort_Frankel::get_scheme() const
+* \brief Name of the scheme
+*
+* \return scheme - the name of the scheme
+*/
+std::string DuFort_Frankel::get_scheme() const {
+	return "DuFort_Frankel";
+}
+
+/**
+* \fn std::string DuFort_Frankel::get_key() const
+* \brief Key which identify the problem. With the fast division the solution is not the
+* same to the last bit, so it is stored under another key.
+*
+* \return key - the key of HeatConduction, followed by "fast_division" if it is used
+*/
+std::string DuFort_Frankel::get_key() const {
+	if (fast){
+		return HeatConduction::get_key() + " fast_division";
+	}
+	return HeatConduction::get_key();
 }
 
 /**
@@ -267,6 +715,20 @@ void DuFort_Frankel::advance(int i){
 */
 Richardson::Richardson(double Tin_0, double Text_0, double Xmin, double Xmax, double Tend, double D, double dx, double dt) : ExplicitMethod(Tin_0, Text_0, Xmin, Xmax, Tend, D, dx, dt) {}
 
+/**
+* \fn void Richardson::march(int steps)
+* \brief March with the scheme specialized on s if there is one, or with ExplicitMethod::march
+*
+* \param steps - the number of time steps
+* \return void - the result is stored in the vectors u_nminus1 and u_n of the mother Class
+*/
+void Richardson::march(int steps){
+	if (fixedSize && solve_fixed_size(RICHARDSON, s, steps, r, Text_0, false, u_nminus1, u_n)){
+		return;
+	}
+	ExplicitMethod::march(steps);
+}
+
 /**
 * \fn void Richardson::advance(int i)
 * \brief Calcul of un_plus1 according to Richardson scheme
@@ -278,6 +740,16 @@ void Richardson::advance(int i){
 	u_nplus1[i] = u_nminus1[i] + 2 * r * (u_n[i + 1] - (2 * u_n[i] + u_n[i - 1]));
 }
 
+/**
+* \fn std::string Richardson::get_scheme() const
+* \brief Name of the scheme
+*
+* \return scheme - the name of the scheme
+*/
+std::string Richardson::get_scheme() const {
+	return "Richardson";
+}
+
 /**
 * \fn Laasonen::Laasonen(double Tin_0, double Text_0, double Xmin, double Xmax, double Tend, double D, double dx, double dt)
 * \brief Constructor of the Laasonen class
@@ -295,11 +767,28 @@ Laasonen::Laasonen(double Tin_0, double Text_0, double Xmin, double Xmax, double
 
 /**
 * \fn void Laasonen::solve()
-* \brief Solve method. The matrix abc and the vector d are define after the Laasonen scheme
+* \brief Solve method : march the n time steps from u_n
 *
 * \return void - the result is stored in the vector u_n of the mother Class
 */
 void Laasonen::solve(){ 
+	march(n);
+}
+
+/**
+* \fn void Laasonen::march(int steps)
+* \brief Continue the solution from u_n by a number of time steps, the matrix abc and the vector d are define after the Laasonen scheme
+*
+* The scheme specialized on s is used if there is one.
+*
+* \param steps - the number of time steps
+* \return void - the result is stored in the vector u_n of the mother Class
+*/
+void Laasonen::march(int steps){
+	if (fixedSize && solve_fixed_size(LAASONEN, s, steps, r, Text_0, false, u_nminus1, u_n)){
+		return;
+	}
+
 	for (int i = 0; i < s-1; i++){
 		a[i] = -r; // bottom diagonal
 		b[i] = 2*r + 1; // central diagonal
@@ -309,7 +798,7 @@ void Laasonen::solve(){
 	a[0] = 0;
 	c[s - 2] = 0;
 
-	for (int j = 1; j < n + 1; j++){
+	for (int j = 1; j < steps + 1; j++){
 		//Boundaries conditions
 		d[0] += Text_0 * r;
 		d[s - 2] += Text_0 * r;
@@ -324,6 +813,16 @@ void Laasonen::solve(){
 	}
 }
 
+/**
+* \fn std::string Laasonen::get_scheme() const
+* \brief Name of the scheme
+*
+* \return scheme - the name of the scheme
+*/
+std::string Laasonen::get_scheme() const {
+	return "Laasonen";
+}
+
 /**
 * \fn CrankNicholson::CrankNicholson(double Tin_0, double Text_0, double Xmin, double Xmax, double Tend, double D, double dx, double dt)
 * \brief Constructor of the Laasonen class
@@ -341,11 +840,28 @@ CrankNicholson::CrankNicholson(double Tin_0, double Text_0, double Xmin, double
 
 /**
 * \fn void CrankNicholson::solve()
-* \brief Solve method. The matrix abc and the vector d are define after the Crank-Nicholson scheme
+* \brief Solve method : march the n time steps from u_n
 *
 * \return void - the result is stored in the vector u_n of the mother Class
 */
 void CrankNicholson::solve(){
+	march(n);
+}
+
+/**
+* \fn void CrankNicholson::march(int steps)
+* \brief Continue the solution from u_n by a number of time steps, the matrix abc and the vector d are define after the Crank-Nicholson scheme
+*
+* The scheme specialized on s is used if there is one.
+*
+* \param steps - the number of time steps
+* \return void - the result is stored in the vector u_n of the mother Class
+*/
+void CrankNicholson::march(int steps){
+	if (fixedSize && solve_fixed_size(CRANK_NICHOLSON, s, steps, r, Text_0, false, u_nminus1, u_n)){
+		return;
+	}
+
 	for (int i = 0; i < s - 1; i++){
 		a[i] = -r/2; // bottom diagonal
 		b[i] = r + 1; // central diagonal
@@ -355,7 +871,7 @@ void CrankNicholson::solve(){
 	a[0] = 0;
 	c[s - 2] = 0;
 
-	for (int j = 1; j < n + 1; j++){
+	for (int j = 1; j < steps + 1; j++){
 		//Boundaries conditions
 		d[0] += Text_0 * (r/2);
 		d[s - 2] += Text_0 * (r/2);
@@ -368,4 +884,50 @@ void CrankNicholson::solve(){
 			d[i] = (r / 2)*u_n[i + 2] + (1 - r)*u_n[i + 1] + (r / 2)*u_n[i];
 		}
 	}
+}
+
+/**
+* \fn std::string CrankNicholson::get_scheme() const
+* \brief Name of the scheme
+*
+* \return scheme - the name of the scheme
+*/
+std::string CrankNicholson::get_scheme() const {
+	return "CrankNicholson";
+}
+
+//
+// ...... FACTORY ......
+//
+
+/**
+* \fn HeatConduction* create_problem(int scheme, double Tin_0, double Text_0, double Xmin, double Xmax, double Tend, double D, double dx, double dt)
+* \brief Create the object corresponding to a scheme given at runtime
+*
+* \param scheme - a value of the enum Scheme
+* \param Tin_0 - initial condition Temperature inside
+* \param Text_0 - initial condition Temperature outside
+* \param Xmin - the X position far left
+* \param Xmax - the X position far right
+* \param Tend - the end time of the simulation
+* \param D - the difusivity of the wall
+* \param dx - the space step
+* \param dt - the time step
+* \return problem - the new object, to delete by the caller, or nullptr if the scheme is unknown
+*/
+HeatConduction* create_problem(int scheme, double Tin_0, double Text_0, double Xmin, double Xmax, double Tend, double D, double dx, double dt){
+	switch (scheme){
+	case ANALYTICAL:
+		return new AnalyticalSolution(Tin_0, Text_0, Xmin, Xmax, Tend, D, dx, dt);
+	case DUFORT_FRANKEL:
+		return new DuFort_Frankel(Tin_0, Text_0, Xmin, Xmax, Tend, D, dx, dt);
+	case RICHARDSON:
+		return new Richardson(Tin_0, Text_0, Xmin, Xmax, Tend, D, dx, dt);
+	case LAASONEN:
+		return new Laasonen(Tin_0, Text_0, Xmin, Xmax, Tend, D, dx, dt);
+	case CRANK_NICHOLSON:
+		return new CrankNicholson(Tin_0, Text_0, Xmin, Xmax, Tend, D, dx, dt);
+	default:
+		return nullptr;
+	}
 }
\ No newline at end of file
@@ -13,7 +13,11 @@
 *			It can also provide the analytical solution.
 */
 
+#pragma once
+
 #include <vector>
+#include <string>
+#include <atomic>
 
 /**
 * \class HeatConduction
@@ -40,10 +44,38 @@ protected:
 	std::vector<double> u_nplus1; //!< solution values vector n+1
 	std::vector<double> u_n; //!< solution values vector n
 	std::vector<double> u_nminus1; //!< solution values vector n-1	
+	bool modified; //!< true if u_n was given by set_u_n, so the state is no more the one described by the key
+	static std::atomic<bool> fixedSize; //!< use the schemes of FixedSizeSchemes.h when s allows it, read by the solving threads
+	static std::atomic<bool> fastDivision; //!< fastDivision of the DuFort_Frankel objects created after, see set_fast_division
 public:
 	HeatConduction(double Tin_0, double Text_0, double Xmin, double Xmax, double Tend, double D, double dx, double dt);
+	virtual ~HeatConduction();
 	virtual void solve();
+	virtual void set_parameters(double Tin_0, double Text_0, double Xmin, double Xmax, double Tend, double D, double dx, double dt);
+	virtual void initialise();
+	virtual void march(int steps);
 	std::vector<double> get_u_n() const;
+	const std::vector<double>& get_u_n_view() const;
+	void set_u_n(std::vector<double> u_n);
+	void restore_u_n(const std::vector<double> &u_n);
+	bool is_modified() const;
+	double get_Tin_0() const;
+	double get_Text_0() const;
+	double get_Xmin() const;
+	double get_Xmax() const;
+	double get_Tend() const;
+	double get_D() const;
+	double get_dx() const;
+	double get_dt() const;
+	int get_n() const;
+	int get_s() const;
+	double get_r() const;
+	static void set_fixed_size(bool fixedSize);
+	static bool get_fixed_size();
+	static void set_fast_division(bool fastDivision);
+	static bool get_fast_division();
+	virtual std::string get_scheme() const;
+	virtual std::string get_key() const;
 };
 
 /**
@@ -57,6 +89,8 @@ class AnalyticalSolution : public HeatConduction{
 public:
 	AnalyticalSolution(double Tin_0, double Text_0, double Xmin, double Xmax, double Tend, double D, double dx, double dt);
 	virtual void solve();
+	virtual std::string get_scheme() const;
+	virtual std::string get_key() const;
 };
 
 /**
@@ -71,6 +105,8 @@ class ExplicitMethod : public HeatConduction{
 public:
 	ExplicitMethod(double Tin_0, double Text_0, double Xmin, double Xmax, double Tend, double D, double dx, double dt);
 	virtual void solve();
+	virtual void initialise();
+	virtual void march(int steps);
 	virtual void advance(int i);
 };
 
@@ -92,6 +128,8 @@ protected:
 public:
 	ImplicitMethod(double Tin_0, double Text_0, double Xmin, double Xmax, double Tend, double D, double dx, double dt);
 	virtual void solve();
+	virtual void set_parameters(double Tin_0, double Text_0, double Xmin, double Xmax, double Tend, double D, double dx, double dt);
+	virtual void initialise();
 	void ThomasAlgorith();
 };
 
@@ -105,9 +143,16 @@ public:
 * at the extremities.
 */
 class DuFort_Frankel : public ExplicitMethod{
+private:
+	double inverse; //!< 1/(1+2r), used with fast
+	bool fast; //!< multiply by inverse instead of dividing, fixed at the creation so the key and the solution always agree
 public:
 	DuFort_Frankel(double Tin_0, double Text_0, double Xmin, double Xmax, double Tend, double D, double dx, double dt);
+	virtual void initialise();
+	virtual void march(int steps);
 	virtual void advance(int i);
+	virtual std::string get_scheme() const;
+	virtual std::string get_key() const;
 };
 
 /**
@@ -122,7 +167,9 @@ public:
 class Richardson : public ExplicitMethod{
 public:
 	Richardson(double Tin_0, double Text_0, double Xmin, double Xmax, double Tend, double D, double dx, double dt);
+	virtual void march(int steps);
 	virtual void advance(int i);
+	virtual std::string get_scheme() const;
 };
 
 /**
@@ -138,6 +185,8 @@ class Laasonen : public ImplicitMethod{
 public:
 	Laasonen(double Tin_0, double Text_0, double Xmin, double Xmax, double Tend, double D, double dx, double dt);
 	virtual void solve();
+	virtual void march(int steps);
+	virtual std::string get_scheme() const;
 };
 
 /**
@@ -153,4 +202,20 @@ class CrankNicholson : public ImplicitMethod{
 public:
 	CrankNicholson(double Tin_0, double Text_0, double Xmin, double Xmax, double Tend, double D, double dx, double dt);
 	virtual void solve();
-};
\ No newline at end of file
+	virtual void march(int steps);
+	virtual std::string get_scheme() const;
+};
+
+/**
+* \enum Scheme
+* \brief Identifier of the schemes, used to create a problem at runtime
+*/
+enum Scheme {
+	ANALYTICAL = 0, //!< AnalyticalSolution
+	DUFORT_FRANKEL = 1, //!< DuFort_Frankel
+	RICHARDSON = 2, //!< Richardson
+	LAASONEN = 3, //!< Laasonen
+	CRANK_NICHOLSON = 4 //!< CrankNicholson
+};
+
+HeatConduction* create_problem(int scheme, double Tin_0, double Text_0, double Xmin, double Xmax, double Tend, double D, double dx, double dt);
\ No newline at end of file
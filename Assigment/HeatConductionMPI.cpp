@@ -0,0 +1,374 @@
+/**
+* \file      HeatConductionMPI.cpp
+* \author    m.leclech
+* \version   1.0
+* \date      19 October 2026
+* \brief     Heat Conduction problem distributed on several MPI processes.
+*
+* \details   See HeatConductionMPI.h for the split of the wall and the algorithms.
+*/
+
+#include "HeatConductionMPI.h"
+#include "HeatConduction.h"
+#include <iostream>
+#include <cmath>
+#include <algorithm>
+
+//
+// ...... BASE CLASS ......
+//
+
+/**
+* \fn DistributedHeatConduction::DistributedHeatConduction(MPI_Comm comm, int scheme, double Tin_0, double Text_0, double Xmin, double Xmax, double Tend, double D, double dx, double dt)
+* \brief Constructor of the DistributedHeatConduction class, which split the interior points between the processes
+*
+* \param comm - the communicator of the processes which share the problem
+* \param scheme - a value of the enum Scheme
+* \param Tin_0 - initial condition Temperature inside
+* \param Text_0 - initial condition Temperature outside
+* \param Xmin - the X position far left
+* \param Xmax - the X position far right
+* \param Tend - the end time of the simulation
+* \param D - the difusivity of the wall
+* \param dx - the space step
+* \param dt - the time step
+*/
+DistributedHeatConduction::DistributedHeatConduction(MPI_Comm comm, int scheme, double Tin_0, double Text_0, double Xmin, double Xmax, double Tend, double D, double dx, double dt){
+	this->comm = comm;
+	this->scheme = scheme;
+	this->Tin_0 = Tin_0;
+	this->Text_0 = Text_0;
+	this->D = D;
+	this->dx = dx;
+	this->dt = dt;
+	MPI_Comm_rank(comm, &rank);
+	MPI_Comm_size(comm, &size);
+
+	// same definitions as HeatConduction
+	r = (D*dt) / (dx*dx);
+	n = int(Tend / dt);
+	s = int((Xmax - Xmin) / dx);
+
+	// the s-1 interior points are split in blocks which differ by one point at most
+	int interior = s - 1;
+	if (interior < size){
+		if (rank == 0){
+			std::cerr << "The " << interior << " interior points cannot be split between " << size << " processes" << std::endl;
+		}
+		MPI_Abort(comm, 1);
+	}
+	count = interior / size + (rank < interior % size ? 1 : 0);
+	first = 1 + rank * (interior / size) + std::min(rank, interior % size);
+
+	// initialisation of u_n for n = 0, the ghost points are the boundaries or the neighbours
+	u_n = std::vector<double>(count + 2, Tin_0);
+	if (rank == 0){
+		u_n[0] = Text_0;
+	}
+	if (rank == size - 1){
+		u_n[count + 1] = Text_0;
+	}
+}
+
+/**
+* \fn DistributedHeatConduction::~DistributedHeatConduction()
+* \brief Virtual destructor
+*/
+DistributedHeatConduction::~DistributedHeatConduction() {}
+
+/**
+* \fn void DistributedHeatConduction::solve()
+* \brief Abstract solve
+*
+* \return void - the result is stored in the vector u_n
+*/
+void DistributedHeatConduction::solve() {}
+
+/**
+* \fn void DistributedHeatConduction::exchange_ghosts(std::vector<double> &u)
+* \brief Send the points at the ends of the block to the neighbours, and receive their points in the ghost points
+*
+* The ghost points at the ends of the wall are not changed, they keep the boundaries conditions.
+*
+* \param u - a local vector with its ghost points
+* \return void
+*/
+void DistributedHeatConduction::exchange_ghosts(std::vector<double> &u){
+	int left = rank > 0 ? rank - 1 : MPI_PROC_NULL;
+	int right = rank < size - 1 ? rank + 1 : MPI_PROC_NULL;
+	MPI_Sendrecv(&u[1], 1, MPI_DOUBLE, left, 0, &u[count + 1], 1, MPI_DOUBLE, right, 0, comm, MPI_STATUS_IGNORE);
+	MPI_Sendrecv(&u[count], 1, MPI_DOUBLE, right, 1, &u[0], 1, MPI_DOUBLE, left, 1, comm, MPI_STATUS_IGNORE);
+}
+
+/**
+* \fn std::vector<double> DistributedHeatConduction::gather_u_n() const
+* \brief Gather the whole solution on the process 0
+*
+* \return u_n - the solution of size s+1 on the process 0, an empty vector on the others
+*/
+std::vector<double> DistributedHeatConduction::gather_u_n() const {
+	std::vector<int> counts(size);
+	std::vector<int> displacements(size);
+	int local = count;
+	MPI_Gather(&local, 1, MPI_INT, &counts[0], 1, MPI_INT, 0, comm);
+
+	std::vector<double> solution;
+	if (rank == 0){
+		for (int p = 1; p < size; p++){
+			displacements[p] = displacements[p - 1] + counts[p - 1];
+		}
+		solution = std::vector<double>(s + 1);
+		solution[0] = Text_0;
+		solution[s] = Text_0;
+	}
+	MPI_Gatherv(const_cast<double*>(&u_n[1]), count, MPI_DOUBLE, rank == 0 ? &solution[1] : nullptr, &counts[0], &displacements[0], MPI_DOUBLE, 0, comm);
+	return solution;
+}
+
+/**
+* \fn int DistributedHeatConduction::get_s() const
+* \brief Get method of the attribute s
+*
+* \return s - the number of space steps of the whole wall
+*/
+int DistributedHeatConduction::get_s() const {
+	return s;
+}
+
+/**
+* \fn int DistributedHeatConduction::get_n() const
+* \brief Get method of the attribute n
+*
+* \return n - the number of time steps
+*/
+int DistributedHeatConduction::get_n() const {
+	return n;
+}
+
+//
+// ...... EXPLICIT ......
+//
+
+/**
+* \fn DistributedExplicitMethod::DistributedExplicitMethod(MPI_Comm comm, int scheme, double Tin_0, double Text_0, double Xmin, double Xmax, double Tend, double D, double dx, double dt)
+* \brief Constructor of the DistributedExplicitMethod class
+*
+* \param comm - the communicator of the processes which share the problem
+* \param scheme - RICHARDSON, otherwise the DuFort-Frankel scheme is used
+* \param Tin_0 - initial condition Temperature inside
+* \param Text_0 - initial condition Temperature outside
+* \param Xmin - the X position far left
+* \param Xmax - the X position far right
+* \param Tend - the end time of the simulation
+* \param D - the difusivity of the wall
+* \param dx - the space step
+* \param dt - the time step
+*/
+DistributedExplicitMethod::DistributedExplicitMethod(MPI_Comm comm, int scheme, double Tin_0, double Text_0, double Xmin, double Xmax, double Tend, double D, double dx, double dt) : DistributedHeatConduction(comm, scheme, Tin_0, Text_0, Xmin, Xmax, Tend, D, dx, dt) {}
+
+/**
+* \fn void DistributedExplicitMethod::solve()
+* \brief Solve like ExplicitMethod::solve, with one exchange of ghost points per time step
+*
+* \return void - the result is stored in the vector u_n
+*/
+void DistributedExplicitMethod::solve(){
+	/* initialisation n = -1 and n = 0, the ghost points at the ends of the wall are the boundaries */
+	std::vector<double> u_nminus1(count + 2, Tin_0);
+	std::vector<double> u_nplus1(count + 2, Tin_0);
+	for (int i = 1; i < count + 1; i++){
+		u_n[i] = Tin_0;
+	}
+	if (rank == 0){
+		u_nminus1[0] = u_n[0] = u_nplus1[0] = Text_0;
+	}
+	if (rank == size - 1){
+		u_nminus1[count + 1] = u_n[count + 1] = u_nplus1[count + 1] = Text_0;
+	}
+	exchange_ghosts(u_n);
+
+	/* Calculte n = 1 and so on */
+	for (int j = 1; j < n + 1; j++){
+		if (scheme == RICHARDSON){
+			for (int i = 1; i < count + 1; i++){
+				u_nplus1[i] = u_nminus1[i] + 2 * r * (u_n[i + 1] - (2 * u_n[i] + u_n[i - 1]));
+			}
+		}
+		else {
+			for (int i = 1; i < count + 1; i++){
+				u_nplus1[i] = (u_nminus1[i] + 2 * r*(u_n[i + 1] - u_nminus1[i] + u_n[i - 1])) / (1 + 2 * r);
+			}
+		}
+		u_nminus1.swap(u_n);
+		u_n.swap(u_nplus1);
+		exchange_ghosts(u_n);
+	}
+}
+
+//
+// ...... IMPLICIT ......
+//
+
+/**
+* \fn DistributedImplicitMethod::DistributedImplicitMethod(MPI_Comm comm, int scheme, double Tin_0, double Text_0, double Xmin, double Xmax, double Tend, double D, double dx, double dt)
+* \brief Constructor of the DistributedImplicitMethod class, which prepare the partitioned Thomas Algorithm
+*
+* \param comm - the communicator of the processes which share the problem
+* \param scheme - LAASONEN, otherwise the Crank-Nicholson scheme is used
+* \param Tin_0 - initial condition Temperature inside
+* \param Text_0 - initial condition Temperature outside
+* \param Xmin - the X position far left
+* \param Xmax - the X position far right
+* \param Tend - the end time of the simulation
+* \param D - the difusivity of the wall
+* \param dx - the space step
+* \param dt - the time step
+*/
+DistributedImplicitMethod::DistributedImplicitMethod(MPI_Comm comm, int scheme, double Tin_0, double Text_0, double Xmin, double Xmax, double Tend, double D, double dx, double dt) : DistributedHeatConduction(comm, scheme, Tin_0, Text_0, Xmin, Xmax, Tend, D, dx, dt) {
+	bool laasonen = (scheme == LAASONEN);
+	a = laasonen ? -r : -r / 2;
+	boundary = laasonen ? Text_0 * r : Text_0 * (r / 2);
+
+	// forward elimination of the local block, made once
+	m = std::vector<double>(count);
+	b = std::vector<double>(count);
+	b[0] = laasonen ? 2 * r + 1 : r + 1;
+	for (int k = 1; k < count; k++){
+		m[k] = a / b[k - 1];
+		b[k] = b[0] - (m[k] * a);
+	}
+
+	// coupling solutions : T v = e_first and T w = e_last
+	v = std::vector<double>(count, 0.0);
+	w = std::vector<double>(count, 0.0);
+	v[0] = 1;
+	w[count - 1] = 1;
+	local_solve(v);
+	local_solve(w);
+
+	// reduced system on the ends of the blocks : z[2p] is the first point of the process p, z[2p+1] its last point
+	double coefficients[4] = { a * v[0], a * w[0], a * v[count - 1], a * w[count - 1] };
+	std::vector<double> all(4 * size);
+	MPI_Gather(coefficients, 4, MPI_DOUBLE, &all[0], 4, MPI_DOUBLE, 0, comm);
+	if (rank != 0){
+		return;
+	}
+	// the row i only use the columns i-2 to i+2, stored at reduced[5*i + 2 + column - i]
+	int N = 2 * size;
+	reduced = std::vector<double>(5 * N, 0.0);
+	for (int p = 0; p < size; p++){
+		for (int e = 0; e < 2; e++){
+			int row = 2 * p + e;
+			reduced[5 * row + 2] = 1;
+			if (p > 0){
+				reduced[5 * row + 2 + (2 * p - 1) - row] = all[4 * p + 2 * e]; // last point of the left neighbour
+			}
+			if (p < size - 1){
+				reduced[5 * row + 2 + (2 * p + 2) - row] = all[4 * p + 2 * e + 1]; // first point of the right neighbour
+			}
+		}
+	}
+
+	// banded LU factorisation, made once. The matrix of the wall is diagonally dominant, so
+	// |a*v| + |a*w| < 1 on each row of the reduced system and no pivoting is needed
+	for (int k = 0; k < N; k++){
+		for (int i = k + 1; i < std::min(k + 3, N); i++){
+			reduced[5 * i + 2 + k - i] /= reduced[5 * k + 2];
+			for (int j = k + 1; j < std::min(k + 3, N); j++){
+				reduced[5 * i + 2 + j - i] -= reduced[5 * i + 2 + k - i] * reduced[5 * k + 2 + j - k];
+			}
+		}
+	}
+}
+
+/**
+* \fn void DistributedImplicitMethod::local_solve(std::vector<double> &y) const
+* \brief Thomas Algorithm on the local block, the matrix being already eliminated
+*
+* \param y - the right side of the equation, replaced by the solution
+* \return void
+*/
+void DistributedImplicitMethod::local_solve(std::vector<double> &y) const {
+	//Forward elimination phase
+	for (int k = 1; k < count; k++){
+		y[k] = y[k] - (m[k] * y[k - 1]);
+	}
+
+	//Backward elimination phase
+	y[count - 1] = y[count - 1] / b[count - 1];
+	for (int k = count - 2; k > -1; k--){
+		y[k] = (y[k] - (a * y[k + 1])) / b[k];
+	}
+}
+
+/**
+* \fn void DistributedImplicitMethod::solve()
+* \brief Solve like Laasonen::solve or CrankNicholson::solve, with the partitioned Thomas Algorithm
+*
+* At each time step the local blocks are solved, the process 0 solve the reduced system
+* with the ends of the blocks, and each process correct its block with the points of
+* its neighbours.
+*
+* \return void - the result is stored in the vector u_n
+*/
+void DistributedImplicitMethod::solve(){
+	int N = 2 * size;
+	std::vector<double> y(count);
+	std::vector<double> ends(N);
+	std::vector<double> neighbours(N);
+	exchange_ghosts(u_n);
+
+	for (int j = 1; j < n + 1; j++){
+		// vector on the right of the equation
+		if (scheme == LAASONEN){
+			for (int k = 0; k < count; k++){
+				y[k] = u_n[k + 1];
+			}
+		}
+		else {
+			for (int k = 0; k < count; k++){
+				y[k] = (r / 2)*u_n[k + 2] + (1 - r)*u_n[k + 1] + (r / 2)*u_n[k];
+			}
+		}
+		//Boundaries conditions
+		if (rank == 0){
+			y[0] += boundary;
+		}
+		if (rank == size - 1){
+			y[count - 1] += boundary;
+		}
+
+		local_solve(y);
+
+		// reduced system, solved with the banded LU factorisation on the process 0
+		double local[2] = { y[0], y[count - 1] };
+		MPI_Gather(local, 2, MPI_DOUBLE, &ends[0], 2, MPI_DOUBLE, 0, comm);
+		if (rank == 0){
+			for (int i = 1; i < N; i++){
+				for (int k = std::max(0, i - 2); k < i; k++){
+					ends[i] -= reduced[5 * i + 2 + k - i] * ends[k];
+				}
+			}
+			for (int i = N - 1; i > -1; i--){
+				for (int k = i + 1; k < std::min(i + 3, N); k++){
+					ends[i] -= reduced[5 * i + 2 + k - i] * ends[k];
+				}
+				ends[i] /= reduced[5 * i + 2];
+			}
+			// each process need the last point of its left neighbour and the first point of its right neighbour
+			for (int p = 0; p < size; p++){
+				neighbours[2 * p] = p > 0 ? ends[2 * p - 1] : 0;
+				neighbours[2 * p + 1] = p < size - 1 ? ends[2 * p + 2] : 0;
+			}
+		}
+		double coupling[2];
+		MPI_Scatter(&neighbours[0], 2, MPI_DOUBLE, coupling, 2, MPI_DOUBLE, 0, comm);
+
+		for (int k = 0; k < count; k++){
+			u_n[k + 1] = y[k] - a * coupling[0] * v[k] - a * coupling[1] * w[k];
+		}
+		if (scheme != LAASONEN){
+			exchange_ghosts(u_n);
+		}
+	}
+}
@@ -0,0 +1,95 @@
+/**
+* \file      HeatConductionMPI.h
+* \author    m.leclech
+* \version   1.0
+* \date      19 October 2026
+* \brief     Heat Conduction problem distributed on several MPI processes.
+*
+* \details   The interior points of the wall are split in contiguous blocks, one
+*            per process :
+*              - the explicit schemes exchange one ghost point of u_n with each
+*                neighbour at each time step, u_nminus1 stay local
+*              - the implicit schemes solve the tridiagonal system with a partitioned
+*                Thomas Algorithm : each process eliminate its own block, and the
+*                unknowns at the ends of the blocks are found with a reduced system
+*                of 2 equations per process, pentadiagonal, solved by the process 0
+*            The ends of all the blocks are gathered on the process 0 at each time
+*            step, so its work and its messages grow with the number of processes,
+*            which limit the strong scaling of the implicit schemes on many processes.
+*            The results are the same as the HeatConduction classes, up to the
+*            rounding errors for the implicit schemes. These files need MPI and
+*            are not part of the Visual Studio project.
+*/
+
+#pragma once
+
+#include <mpi.h>
+#include <vector>
+
+/**
+* \class DistributedHeatConduction
+* \brief Base abstract Class which include the parameters of the problem and the split of the wall
+*
+* Each process own the interior points first to last-1 (global index), which are
+* stored at the local index 1 to count, with a ghost point at each end.
+*/
+class DistributedHeatConduction {
+protected:
+	MPI_Comm comm; //!< communicator of the processes which share the problem
+	int rank; //!< number of this process
+	int size; //!< number of processes
+	int scheme; //!< a value of the enum Scheme
+	double Tin_0; //!< initial condition Temperature
+	double Text_0; //!< initial condition Temperature
+	double D; //!< initial condition D
+	double dx; //!< space step
+	double dt; //!< time step
+	int n; //!< number of time steps
+	int s; //!< number of space steps
+	double r; //!< calculation made once instead of multiple time
+	int first; //!< global index of the first point of this process
+	int count; //!< number of points of this process
+	std::vector<double> u_n; //!< solution values vector n, with the ghost points
+	void exchange_ghosts(std::vector<double> &u);
+public:
+	DistributedHeatConduction(MPI_Comm comm, int scheme, double Tin_0, double Text_0, double Xmin, double Xmax, double Tend, double D, double dx, double dt);
+	virtual ~DistributedHeatConduction();
+	virtual void solve();
+	std::vector<double> gather_u_n() const;
+	int get_s() const;
+	int get_n() const;
+};
+
+/**
+* \class DistributedExplicitMethod
+* \brief Sub Class used to calculate the DuFort_Frankel and Richardson schemes
+*/
+class DistributedExplicitMethod : public DistributedHeatConduction {
+public:
+	DistributedExplicitMethod(MPI_Comm comm, int scheme, double Tin_0, double Text_0, double Xmin, double Xmax, double Tend, double D, double dx, double dt);
+	virtual void solve();
+};
+
+/**
+* \class DistributedImplicitMethod
+* \brief Sub Class used to calculate the Laasonen and Crank-Nicholson schemes
+*
+* The matrix is the same at each time step, so the local elimination of the block,
+* the two coupling solutions v and w and the LU factorisation of the reduced
+* system are made once in the constructor. The reduced system is stored as a band
+* of 5 diagonals, so it costs O(processes) at each time step.
+*/
+class DistributedImplicitMethod : public DistributedHeatConduction {
+protected:
+	double a; //!< lower and upper diagonal of the matrix
+	double boundary; //!< contribution of the boundaries to d
+	std::vector<double> m; //!< var needed in the Thomas Algorithm, for the local block
+	std::vector<double> b; //!< middle diagonal of the local block, once eliminated
+	std::vector<double> v; //!< solution of the local block for the coupling with the left neighbour
+	std::vector<double> w; //!< solution of the local block for the coupling with the right neighbour
+	std::vector<double> reduced; //!< LU factorisation of the reduced system, 5 diagonals per row, on the process 0
+	void local_solve(std::vector<double> &y) const;
+public:
+	DistributedImplicitMethod(MPI_Comm comm, int scheme, double Tin_0, double Text_0, double Xmin, double Xmax, double Tend, double D, double dx, double dt);
+	virtual void solve();
+};
@@ -0,0 +1,723 @@
+/**
+* \file      HeatConductionPython.cpp
+* \author    m.leclech
+* \version   1.0
+* \date      19 October 2026
+* \brief     Python module heatconduction, made with the Python and NumPy C API.
+*
+* \details   The module give access to :
+*              - the HeatConduction classes, with their parameters, and create_problem
+*              - the norms and the error point by point
+*              - the ResultCache
+*            The solutions are read only NumPy arrays which are views on the vector u_n
+*            of the objects, without copy, and they keep their object alive, so an object
+*            cannot be constructed twice. The solve methods release the GIL, so several
+*            problems can be solved in parallel by Python threads, but a problem which is
+*            being solved cannot be solved or changed by another thread. The exceptions
+*            of the C++ classes are turned into Python exceptions (MemoryError for
+*            std::bad_alloc). The module is built with setup.py.
+*/
+
+#define PY_SSIZE_T_CLEAN
+#define NPY_NO_DEPRECATED_API NPY_1_7_API_VERSION
+#include <Python.h>
+#include <numpy/arrayobject.h>
+#include "HeatConduction.h"
+#include "Norms.h"
+#include "ResultCache.h"
+#include <exception>
+#include <new>
+
+const double MAX_SPACE_STEPS = 1 << 24; //!< maximum number of space steps of a problem, like the SolverService
+const double MAX_TIME_STEPS = 2e9; //!< maximum number of time steps of a problem, so that n fit in an int
+
+/**
+* \struct ProblemObject
+* \brief Python object of the HeatConduction classes
+*/
+struct ProblemObject {
+	PyObject_HEAD
+	HeatConduction *problem; //!< the C++ object, owned by the Python object
+	bool solving; //!< true while a thread solve the problem without the GIL
+};
+
+/**
+* \struct CacheObject
+* \brief Python object of the ResultCache class
+*/
+struct CacheObject {
+	PyObject_HEAD
+	ResultCache *cache; //!< the C++ object, owned by the Python object
+};
+
+static PyObject *ProblemType = nullptr; //!< type HeatConduction
+static PyObject *SchemeTypes[5] = { nullptr, nullptr, nullptr, nullptr, nullptr }; //!< type of each value of the enum Scheme
+
+/**
+* \fn PyObject* raise_exception(std::exception_ptr failure, PyObject *type)
+* \brief Turn a C++ exception into a Python exception, called with the GIL
+*
+* \param failure - the exception, e.g. std::current_exception() in a catch block
+* \param type - the Python exception used for all the exceptions but std::bad_alloc
+* \return nullptr - with the Python exception set
+*/
+static PyObject* raise_exception(std::exception_ptr failure, PyObject *type){
+	try {
+		std::rethrow_exception(failure);
+	}
+	catch (const std::bad_alloc&){
+		PyErr_NoMemory();
+	}
+	catch (const std::exception &exception){
+		PyErr_SetString(type, exception.what());
+	}
+	catch (...){
+		PyErr_SetString(type, "unknown C++ exception");
+	}
+	return nullptr;
+}
+
+//
+// ...... HEAT CONDUCTION ......
+//
+
+/**
+* \fn int problem_init(PyObject *self, PyObject *args, PyObject *kwargs)
+* \brief Constructor of the Python classes, the scheme is given by the template parameter
+*
+* \param self - the new object
+* \param args - Tin_0, Text_0, Xmin, Xmax, Tend, D, dx, dt
+* \param kwargs - the same arguments by name
+* \return 0 - or -1 with an exception if the parameters are wrong, too large or if the object is already constructed
+*/
+template <int scheme>
+static int problem_init(PyObject *self, PyObject *args, PyObject *kwargs){
+	static const char *names[] = { "Tin_0", "Text_0", "Xmin", "Xmax", "Tend", "D", "dx", "dt", nullptr };
+	double Tin_0, Text_0, Xmin, Xmax, Tend, D, dx, dt;
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "dddddddd", (char**)names, &Tin_0, &Text_0, &Xmin, &Xmax, &Tend, &D, &dx, &dt)){
+		return -1;
+	}
+	if (!(dx > 0) || !(dt > 0) || !(Xmax - Xmin >= 2 * dx) || !(Tend >= 0)){
+		PyErr_SetString(PyExc_ValueError, "dx and dt must be positive, with at least 2 space steps and Tend >= 0");
+		return -1;
+	}
+	if ((Xmax - Xmin) / dx > MAX_SPACE_STEPS || Tend / dt > MAX_TIME_STEPS){
+		PyErr_SetString(PyExc_ValueError, "too many steps : at most 2^24 space steps and 2e9 time steps");
+		return -1;
+	}
+	ProblemObject *object = (ProblemObject*)self;
+	if (object->problem != nullptr){
+		// the views on u_n would point to a deleted vector
+		PyErr_SetString(PyExc_RuntimeError, "the problem is already constructed");
+		return -1;
+	}
+	try {
+		object->problem = create_problem(scheme, Tin_0, Text_0, Xmin, Xmax, Tend, D, dx, dt);
+	}
+	catch (...){
+		raise_exception(std::current_exception(), PyExc_ValueError);
+		return -1;
+	}
+	return 0;
+}
+
+/**
+* \fn int abstract_init(PyObject *self, PyObject *args, PyObject *kwargs)
+* \brief Constructor of the abstract classes, which refuse to create an object
+*
+* \return -1 - with a TypeError
+*/
+static int abstract_init(PyObject *self, PyObject *args, PyObject *kwargs){
+	PyErr_Format(PyExc_TypeError, "%s is an abstract class", Py_TYPE(self)->tp_name);
+	return -1;
+}
+
+/**
+* \fn void problem_dealloc(PyObject *self)
+* \brief Destructor of the Python classes, which delete the C++ object
+*
+* \param self - the object
+*/
+static void problem_dealloc(PyObject *self){
+	PyTypeObject *type = Py_TYPE(self);
+	delete ((ProblemObject*)self)->problem;
+	type->tp_free(self);
+	Py_DECREF(type);
+}
+
+/**
+* \fn HeatConduction* get_problem(PyObject *self)
+* \brief C++ object of a Python object, with an exception if it was not constructed
+*
+* \param self - the object
+* \return problem - the C++ object, or nullptr
+*/
+static HeatConduction* get_problem(PyObject *self){
+	HeatConduction *problem = ((ProblemObject*)self)->problem;
+	if (problem == nullptr){
+		PyErr_SetString(PyExc_RuntimeError, "the problem was not constructed");
+	}
+	return problem;
+}
+
+/**
+* \fn HeatConduction* lock_problem(PyObject *self)
+* \brief C++ object of a Python object, marked as being solved until unlock_problem
+*
+* The flag is read and written with the GIL, so two threads cannot both get the object.
+*
+* \param self - the object
+* \return problem - the C++ object, or nullptr with an exception if it was not constructed or is being solved
+*/
+static HeatConduction* lock_problem(PyObject *self){
+	HeatConduction *problem = get_problem(self);
+	if (problem == nullptr){
+		return nullptr;
+	}
+	if (((ProblemObject*)self)->solving){
+		PyErr_SetString(PyExc_RuntimeError, "the problem is being solved by another thread");
+		return nullptr;
+	}
+	((ProblemObject*)self)->solving = true;
+	return problem;
+}
+
+/**
+* \fn void unlock_problem(PyObject *self)
+* \brief End of the solve started by lock_problem, called with the GIL
+*
+* \param self - the object
+*/
+static void unlock_problem(PyObject *self){
+	((ProblemObject*)self)->solving = false;
+}
+
+/**
+* \fn PyObject* problem_solve(PyObject *self, PyObject *unused)
+* \brief Solve the problem, without the GIL
+*
+* \param self - the object
+* \param unused - no argument
+* \return None - or an exception if the problem is already being solved or if the solve failed
+*/
+static PyObject* problem_solve(PyObject *self, PyObject *unused){
+	HeatConduction *problem = lock_problem(self);
+	if (problem == nullptr){
+		return nullptr;
+	}
+	std::exception_ptr failure;
+	Py_BEGIN_ALLOW_THREADS
+	try {
+		(*problem).solve();
+	}
+	catch (...){
+		failure = std::current_exception();
+	}
+	Py_END_ALLOW_THREADS
+	unlock_problem(self);
+	if (failure){
+		return raise_exception(failure, PyExc_RuntimeError);
+	}
+	Py_RETURN_NONE;
+}
+
+/**
+* \fn PyObject* problem_get_u_n(PyObject *self, void *closure)
+* \brief View on the solution, without copy
+*
+* \param self - the object, kept alive by the view
+* \param closure - unused
+* \return u_n - a read only array of size s+1
+*/
+static PyObject* problem_get_u_n(PyObject *self, void *closure){
+	HeatConduction *problem = get_problem(self);
+	if (problem == nullptr){
+		return nullptr;
+	}
+	const std::vector<double> &u_n = (*problem).get_u_n_view();
+	npy_intp size = u_n.size();
+	PyObject *view = PyArray_SimpleNewFromData(1, &size, NPY_DOUBLE, (void*)u_n.data());
+	if (view == nullptr){
+		return nullptr;
+	}
+	PyArray_CLEARFLAGS((PyArrayObject*)view, NPY_ARRAY_WRITEABLE); // the solution is changed with set_u_n only
+	Py_INCREF(self);
+	if (PyArray_SetBaseObject((PyArrayObject*)view, self) < 0){
+		Py_DECREF(view);
+		return nullptr;
+	}
+	return view;
+}
+
+/**
+* \fn PyObject* problem_set_u_n(PyObject *self, PyObject *values)
+* \brief Set the solution, e.g. as the initial condition of an implicit scheme
+*
+* \param self - the object
+* \param values - an array of size s+1
+* \return None - or an exception if the problem is being solved
+*/
+static PyObject* problem_set_u_n(PyObject *self, PyObject *values){
+	HeatConduction *problem = get_problem(self);
+	if (problem == nullptr){
+		return nullptr;
+	}
+	if (((ProblemObject*)self)->solving){
+		PyErr_SetString(PyExc_RuntimeError, "the problem is being solved by another thread");
+		return nullptr;
+	}
+	PyArrayObject *array = (PyArrayObject*)PyArray_FROMANY(values, NPY_DOUBLE, 1, 1, NPY_ARRAY_IN_ARRAY);
+	if (array == nullptr){
+		return nullptr;
+	}
+	if (PyArray_SIZE(array) != (*problem).get_s() + 1){
+		Py_DECREF(array);
+		PyErr_SetString(PyExc_ValueError, "the solution must have s+1 values");
+		return nullptr;
+	}
+	double *data = (double*)PyArray_DATA(array);
+	try {
+		(*problem).set_u_n(std::vector<double>(data, data + PyArray_SIZE(array)));
+	}
+	catch (...){
+		Py_DECREF(array);
+		return raise_exception(std::current_exception(), PyExc_RuntimeError);
+	}
+	Py_DECREF(array);
+	Py_RETURN_NONE;
+}
+
+/**
+* \fn PyObject* problem_get_parameter(PyObject *self, void *closure)
+* \brief Get method of the parameters, the closure give the index of the parameter
+*
+* \param self - the object
+* \param closure - index of the parameter in the list of problem_getset
+* \return parameter - a float, or an int for n and s, or a str for scheme and key
+*/
+static PyObject* problem_get_parameter(PyObject *self, void *closure){
+	HeatConduction *problem = get_problem(self);
+	if (problem == nullptr){
+		return nullptr;
+	}
+	try {
+		switch ((int)(Py_intptr_t)closure){
+		case 0: return PyFloat_FromDouble((*problem).get_Tin_0());
+		case 1: return PyFloat_FromDouble((*problem).get_Text_0());
+		case 2: return PyFloat_FromDouble((*problem).get_Xmin());
+		case 3: return PyFloat_FromDouble((*problem).get_Xmax());
+		case 4: return PyFloat_FromDouble((*problem).get_Tend());
+		case 5: return PyFloat_FromDouble((*problem).get_D());
+		case 6: return PyFloat_FromDouble((*problem).get_dx());
+		case 7: return PyFloat_FromDouble((*problem).get_dt());
+		case 8: return PyLong_FromLong((*problem).get_n());
+		case 9: return PyLong_FromLong((*problem).get_s());
+		case 10: return PyFloat_FromDouble((*problem).get_r());
+		case 11: return PyUnicode_FromString((*problem).get_scheme().c_str());
+		default: return PyUnicode_FromString((*problem).get_key().c_str());
+		}
+	}
+	catch (...){
+		return raise_exception(std::current_exception(), PyExc_RuntimeError);
+	}
+}
+
+static PyMethodDef problem_methods[] = {
+	{ "solve", (PyCFunction)problem_solve, METH_NOARGS, "Solve the problem, without the GIL" },
+	{ "set_u_n", (PyCFunction)problem_set_u_n, METH_O, "Set the solution, e.g. as the initial condition of an implicit scheme" },
+	{ nullptr, nullptr, 0, nullptr }
+};
+
+static PyGetSetDef problem_getset[] = {
+	{ (char*)"u_n", problem_get_u_n, nullptr, (char*)"View on the solution, without copy", nullptr },
+	{ (char*)"Tin_0", problem_get_parameter, nullptr, (char*)"initial condition Temperature inside", (void*)0 },
+	{ (char*)"Text_0", problem_get_parameter, nullptr, (char*)"initial condition Temperature outside", (void*)1 },
+	{ (char*)"Xmin", problem_get_parameter, nullptr, (char*)"the X position far left", (void*)2 },
+	{ (char*)"Xmax", problem_get_parameter, nullptr, (char*)"the X position far right", (void*)3 },
+	{ (char*)"Tend", problem_get_parameter, nullptr, (char*)"the end time of the simulation", (void*)4 },
+	{ (char*)"D", problem_get_parameter, nullptr, (char*)"the difusivity of the wall", (void*)5 },
+	{ (char*)"dx", problem_get_parameter, nullptr, (char*)"the space step", (void*)6 },
+	{ (char*)"dt", problem_get_parameter, nullptr, (char*)"the time step", (void*)7 },
+	{ (char*)"n", problem_get_parameter, nullptr, (char*)"number of time steps", (void*)8 },
+	{ (char*)"s", problem_get_parameter, nullptr, (char*)"number of space steps", (void*)9 },
+	{ (char*)"r", problem_get_parameter, nullptr, (char*)"D*dt/(dx*dx)", (void*)10 },
+	{ (char*)"scheme", problem_get_parameter, nullptr, (char*)"name of the scheme", (void*)11 },
+	{ (char*)"key", problem_get_parameter, nullptr, (char*)"key of the problem in a ResultCache", (void*)12 },
+	{ nullptr, nullptr, nullptr, nullptr, nullptr }
+};
+
+/**
+* \fn PyObject* new_type(const char *name, PyObject *base, initproc init, const char *doc)
+* \brief Create one of the Python classes of the hierarchy
+*
+* \param name - the name of the class in the module
+* \param base - the Python base class, nullptr for HeatConduction
+* \param init - the constructor, abstract_init for the abstract classes
+* \param doc - the documentation of the class
+* \return type - the new class
+*/
+static PyObject* new_type(const char *name, PyObject *base, initproc init, const char *doc){
+	PyType_Slot slots[] = {
+		{ Py_tp_dealloc, (void*)problem_dealloc },
+		{ Py_tp_methods, (void*)problem_methods },
+		{ Py_tp_getset, (void*)problem_getset },
+		{ Py_tp_doc, (void*)doc },
+		{ Py_tp_init, (void*)init },
+		{ 0, nullptr }
+	};
+	PyType_Spec spec = { name, sizeof(ProblemObject), 0, Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE, slots };
+	if (base == nullptr){
+		return PyType_FromSpec(&spec);
+	}
+	PyObject *bases = PyTuple_Pack(1, base);
+	if (bases == nullptr){
+		return nullptr;
+	}
+	PyObject *type = PyType_FromSpecWithBases(&spec, bases);
+	Py_DECREF(bases);
+	return type;
+}
+
+//
+// ...... RESULT CACHE ......
+//
+
+/**
+* \fn int cache_init(PyObject *self, PyObject *args, PyObject *kwargs)
+* \brief Constructor of the Python class ResultCache
+*
+* \param self - the new object
+* \param args - capacity, and optionally the directory of the disk tier
+* \param kwargs - the same arguments by name
+* \return 0 - or -1 with an exception if the parameters are wrong or if the cache is already constructed
+*/
+static int cache_init(PyObject *self, PyObject *args, PyObject *kwargs){
+	static const char *names[] = { "capacity", "directory", nullptr };
+	unsigned int capacity = 0;
+	const char *directory = "";
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "I|s", (char**)names, &capacity, &directory)){
+		return -1;
+	}
+	CacheObject *object = (CacheObject*)self;
+	if (object->cache != nullptr){
+		// another thread may be solving with it, without the GIL
+		PyErr_SetString(PyExc_RuntimeError, "the cache is already constructed");
+		return -1;
+	}
+	try {
+		object->cache = new ResultCache(capacity, directory);
+	}
+	catch (...){
+		raise_exception(std::current_exception(), PyExc_ValueError);
+		return -1;
+	}
+	return 0;
+}
+
+/**
+* \fn void cache_dealloc(PyObject *self)
+* \brief Destructor of the Python class ResultCache
+*
+* \param self - the object
+*/
+static void cache_dealloc(PyObject *self){
+	PyTypeObject *type = Py_TYPE(self);
+	delete ((CacheObject*)self)->cache;
+	type->tp_free(self);
+	Py_DECREF(type);
+}
+
+/**
+* \fn PyObject* cache_solve(PyObject *self, PyObject *argument)
+* \brief Solve a problem, or set its solution if it is already known, without the GIL
+*
+* \param self - the cache
+* \param argument - a HeatConduction object
+* \return None - or an exception if the problem is already being solved or if the solve failed
+*/
+static PyObject* cache_solve(PyObject *self, PyObject *argument){
+	ResultCache *cache = ((CacheObject*)self)->cache;
+	if (cache == nullptr){
+		PyErr_SetString(PyExc_RuntimeError, "the cache was not constructed");
+		return nullptr;
+	}
+	if (!PyObject_IsInstance(argument, ProblemType)){
+		PyErr_SetString(PyExc_TypeError, "a HeatConduction object is expected");
+		return nullptr;
+	}
+	HeatConduction *problem = lock_problem(argument);
+	if (problem == nullptr){
+		return nullptr;
+	}
+	std::exception_ptr failure;
+	Py_BEGIN_ALLOW_THREADS
+	try {
+		(*cache).solve(*problem);
+	}
+	catch (...){
+		failure = std::current_exception();
+	}
+	Py_END_ALLOW_THREADS
+	unlock_problem(argument);
+	if (failure){
+		return raise_exception(failure, PyExc_RuntimeError);
+	}
+	Py_RETURN_NONE;
+}
+
+/**
+* \fn PyObject* cache_get_statistic(PyObject *self, void *closure)
+* \brief Get method of the statistics, the closure give the index of the statistic
+*
+* \param self - the cache
+* \param closure - 0 hits, 1 memory hits, 2 disk hits, 3 misses
+* \return statistic - an int
+*/
+static PyObject* cache_get_statistic(PyObject *self, void *closure){
+	ResultCache *cache = ((CacheObject*)self)->cache;
+	if (cache == nullptr){
+		PyErr_SetString(PyExc_RuntimeError, "the cache was not constructed");
+		return nullptr;
+	}
+	switch ((int)(Py_intptr_t)closure){
+	case 0: return PyLong_FromLong((*cache).get_hits());
+	case 1: return PyLong_FromLong((*cache).get_memory_hits());
+	case 2: return PyLong_FromLong((*cache).get_disk_hits());
+	default: return PyLong_FromLong((*cache).get_misses());
+	}
+}
+
+/**
+* \fn PyObject* cache_clear(PyObject *self, PyObject *unused)
+* \brief Remove all the solutions in memory and reset the statistics
+*
+* \param self - the cache
+* \param unused - no argument
+* \return None
+*/
+static PyObject* cache_clear(PyObject *self, PyObject *unused){
+	ResultCache *cache = ((CacheObject*)self)->cache;
+	if (cache != nullptr){
+		(*cache).clear();
+	}
+	Py_RETURN_NONE;
+}
+
+static PyMethodDef cache_methods[] = {
+	{ "solve", (PyCFunction)cache_solve, METH_O, "Solve a problem, or set its solution if it is already known, without the GIL" },
+	{ "clear", (PyCFunction)cache_clear, METH_NOARGS, "Remove all the solutions in memory and reset the statistics" },
+	{ nullptr, nullptr, 0, nullptr }
+};
+
+static PyGetSetDef cache_getset[] = {
+	{ (char*)"hits", cache_get_statistic, nullptr, (char*)"solutions found in memory or on the disk", (void*)0 },
+	{ (char*)"memory_hits", cache_get_statistic, nullptr, (char*)"solutions found in memory", (void*)1 },
+	{ (char*)"disk_hits", cache_get_statistic, nullptr, (char*)"solutions found on the disk", (void*)2 },
+	{ (char*)"misses", cache_get_statistic, nullptr, (char*)"solutions which had to be calculated", (void*)3 },
+	{ nullptr, nullptr, nullptr, nullptr, nullptr }
+};
+
+static PyType_Slot cache_slots[] = {
+	{ Py_tp_init, (void*)cache_init },
+	{ Py_tp_dealloc, (void*)cache_dealloc },
+	{ Py_tp_methods, (void*)cache_methods },
+	{ Py_tp_getset, (void*)cache_getset },
+	{ Py_tp_doc, (void*)"ResultCache(capacity, directory='') : cache of the solutions already calculated" },
+	{ 0, nullptr }
+};
+
+static PyType_Spec cache_spec = { "heatconduction.ResultCache", sizeof(CacheObject), 0, Py_TPFLAGS_DEFAULT, cache_slots };
+
+//
+// ...... FUNCTIONS ......
+//
+
+/**
+* \fn PyObject* module_create_problem(PyObject *module, PyObject *args, PyObject *kwargs)
+* \brief Create the object corresponding to a scheme given at runtime
+*
+* \param module - the module
+* \param args - scheme, Tin_0, Text_0, Xmin, Xmax, Tend, D, dx, dt
+* \param kwargs - the same arguments by name
+* \return problem - an object of the class of the scheme
+*/
+static PyObject* module_create_problem(PyObject *module, PyObject *args, PyObject *kwargs){
+	Py_ssize_t size = PyTuple_Size(args);
+	PyObject *scheme = size > 0 ? PyTuple_GetItem(args, 0) : (kwargs != nullptr ? PyDict_GetItemString(kwargs, "scheme") : nullptr);
+	if (scheme == nullptr){
+		PyErr_SetString(PyExc_TypeError, "the scheme is missing");
+		return nullptr;
+	}
+	long index = PyLong_AsLong(scheme);
+	if (index == -1 && PyErr_Occurred()){
+		return nullptr;
+	}
+	if (index < ANALYTICAL || index > CRANK_NICHOLSON){
+		PyErr_SetString(PyExc_ValueError, "unknown scheme");
+		return nullptr;
+	}
+
+	PyObject *rest = PyTuple_GetSlice(args, size > 0 ? 1 : 0, size);
+	PyObject *options = nullptr;
+	if (kwargs != nullptr){
+		options = PyDict_Copy(kwargs);
+		if (options != nullptr && PyDict_GetItemString(options, "scheme") != nullptr){
+			PyDict_DelItemString(options, "scheme");
+		}
+	}
+	PyObject *problem = rest == nullptr ? nullptr : PyObject_Call(SchemeTypes[index], rest, options);
+	Py_XDECREF(rest);
+	Py_XDECREF(options);
+	return problem;
+}
+
+/**
+* \fn PyObject* module_error(PyObject *module, PyObject *args)
+* \brief Error point by point between a problem and a reference, like the files of main
+*
+* \param module - the module
+* \param args - the problem solved with a scheme, and the reference, usually its AnalyticalSolution
+* \return error - a new array
+*/
+static PyObject* module_error(PyObject *module, PyObject *args){
+	PyObject *first, *second;
+	if (!PyArg_ParseTuple(args, "O!O!", (PyTypeObject*)ProblemType, &first, (PyTypeObject*)ProblemType, &second)){
+		return nullptr;
+	}
+	HeatConduction *problem = get_problem(first);
+	HeatConduction *reference = problem == nullptr ? nullptr : get_problem(second);
+	if (reference == nullptr){
+		return nullptr;
+	}
+	const std::vector<double> &solution = (*problem).get_u_n_view();
+	const std::vector<double> &exact = (*reference).get_u_n_view();
+	if (solution.size() != exact.size()){
+		PyErr_SetString(PyExc_ValueError, "the problem and the reference have a different number of space steps");
+		return nullptr;
+	}
+
+	npy_intp size = solution.size();
+	PyObject *error = PyArray_SimpleNew(1, &size, NPY_DOUBLE);
+	if (error == nullptr){
+		return nullptr;
+	}
+	double *data = (double*)PyArray_DATA((PyArrayObject*)error);
+	for (int i = 0; i < int(size); i++){
+		data[i] = solution[i] - exact[i];
+	}
+	return error;
+}
+
+/**
+* \fn PyObject* module_norm(PyObject *values, double (*norm)(std::vector<double>))
+* \brief Call one of the functions of Norms on an array
+*
+* \param values - a 1D array, not empty
+* \param norm - the function of Norms
+* \return norm - a float
+*/
+static PyObject* module_norm(PyObject *values, double (*norm)(std::vector<double>)){
+	PyArrayObject *array = (PyArrayObject*)PyArray_FROMANY(values, NPY_DOUBLE, 1, 1, NPY_ARRAY_IN_ARRAY);
+	if (array == nullptr){
+		return nullptr;
+	}
+	if (PyArray_SIZE(array) == 0){
+		Py_DECREF(array);
+		PyErr_SetString(PyExc_ValueError, "the array is empty");
+		return nullptr;
+	}
+	double *data = (double*)PyArray_DATA(array);
+	try {
+		std::vector<double> solution(data, data + PyArray_SIZE(array));
+		Py_DECREF(array);
+		return PyFloat_FromDouble(norm(solution));
+	}
+	catch (...){
+		Py_DECREF(array);
+		return raise_exception(std::current_exception(), PyExc_RuntimeError);
+	}
+}
+
+static PyObject* module_norm_one(PyObject *module, PyObject *values){ return module_norm(values, norm_one); }
+static PyObject* module_norm_two(PyObject *module, PyObject *values){ return module_norm(values, norm_two); }
+static PyObject* module_norm_uniform(PyObject *module, PyObject *values){ return module_norm(values, norm_uniform); }
+
+static PyMethodDef module_methods[] = {
+	{ "create_problem", (PyCFunction)(void(*)(void))module_create_problem, METH_VARARGS | METH_KEYWORDS, "create_problem(scheme, Tin_0, Text_0, Xmin, Xmax, Tend, D, dx, dt) : object of the class of the scheme" },
+	{ "error", (PyCFunction)module_error, METH_VARARGS, "error(problem, reference) : error point by point" },
+	{ "norm_one", (PyCFunction)module_norm_one, METH_O, "norm_one(values) : the norm one" },
+	{ "norm_two", (PyCFunction)module_norm_two, METH_O, "norm_two(values) : the Euclidean norm" },
+	{ "norm_uniform", (PyCFunction)module_norm_uniform, METH_O, "norm_uniform(values) : the infinite norm" },
+	{ nullptr, nullptr, 0, nullptr }
+};
+
+static PyModuleDef module_definition = {
+	PyModuleDef_HEAD_INIT, "heatconduction",
+	"Heat Conduction problem of a wall, solved with the DuFort-Frankel, Richardson, Laasonen and Crank-Nicholson schemes",
+	-1, module_methods, nullptr, nullptr, nullptr, nullptr
+};
+
+/**
+* \fn int add_type(PyObject *module, const char *name, PyObject *type)
+* \brief Add a class in the module
+*
+* \param module - the module
+* \param name - the name of the class
+* \param type - the class, its reference is given to the module which keep it alive
+* \return 0 - or -1 with an exception
+*/
+static int add_type(PyObject *module, const char *name, PyObject *type){
+	if (type == nullptr){
+		return -1;
+	}
+	if (PyModule_AddObject(module, name, type) < 0){
+		Py_DECREF(type);
+		return -1;
+	}
+	return 0;
+}
+
+/**
+* \fn PyMODINIT_FUNC PyInit_heatconduction()
+* \brief Creation of the module heatconduction
+*
+* \return module - the module, or nullptr with an exception
+*/
+PyMODINIT_FUNC PyInit_heatconduction(){
+	import_array();
+
+	PyObject *module = PyModule_Create(&module_definition);
+	if (module == nullptr){
+		return nullptr;
+	}
+
+	ProblemType = new_type("heatconduction.HeatConduction", nullptr, abstract_init, "Base class which include all the parameters of the problem");
+	PyObject *explicitType = ProblemType == nullptr ? nullptr : new_type("heatconduction.ExplicitMethod", ProblemType, abstract_init, "Base class of the explicit schemes");
+	PyObject *implicitType = ProblemType == nullptr ? nullptr : new_type("heatconduction.ImplicitMethod", ProblemType, abstract_init, "Base class of the implicit schemes");
+	if (explicitType == nullptr || implicitType == nullptr){
+		Py_DECREF(module);
+		return nullptr;
+	}
+	SchemeTypes[ANALYTICAL] = new_type("heatconduction.AnalyticalSolution", ProblemType, problem_init<ANALYTICAL>, "AnalyticalSolution(Tin_0, Text_0, Xmin, Xmax, Tend, D, dx, dt)");
+	SchemeTypes[DUFORT_FRANKEL] = new_type("heatconduction.DuFort_Frankel", explicitType, problem_init<DUFORT_FRANKEL>, "DuFort_Frankel(Tin_0, Text_0, Xmin, Xmax, Tend, D, dx, dt)");
+	SchemeTypes[RICHARDSON] = new_type("heatconduction.Richardson", explicitType, problem_init<RICHARDSON>, "Richardson(Tin_0, Text_0, Xmin, Xmax, Tend, D, dx, dt)");
+	SchemeTypes[LAASONEN] = new_type("heatconduction.Laasonen", implicitType, problem_init<LAASONEN>, "Laasonen(Tin_0, Text_0, Xmin, Xmax, Tend, D, dx, dt)");
+	SchemeTypes[CRANK_NICHOLSON] = new_type("heatconduction.CrankNicholson", implicitType, problem_init<CRANK_NICHOLSON>, "CrankNicholson(Tin_0, Text_0, Xmin, Xmax, Tend, D, dx, dt)");
+
+	const char *names[5] = { "AnalyticalSolution", "DuFort_Frankel", "Richardson", "Laasonen", "CrankNicholson" };
+	bool ok = add_type(module, "HeatConduction", ProblemType) == 0 && add_type(module, "ExplicitMethod", explicitType) == 0 && add_type(module, "ImplicitMethod", implicitType) == 0;
+	for (int i = 0; i < 5 && ok; i++){
+		ok = add_type(module, names[i], SchemeTypes[i]) == 0;
+	}
+	ok = ok && add_type(module, "ResultCache", PyType_FromSpec(&cache_spec)) == 0;
+
+	// values of the enum Scheme, for create_problem
+	ok = ok && PyModule_AddIntConstant(module, "ANALYTICAL", ANALYTICAL) == 0 && PyModule_AddIntConstant(module, "DUFORT_FRANKEL", DUFORT_FRANKEL) == 0
+		&& PyModule_AddIntConstant(module, "RICHARDSON", RICHARDSON) == 0 && PyModule_AddIntConstant(module, "LAASONEN", LAASONEN) == 0
+		&& PyModule_AddIntConstant(module, "CRANK_NICHOLSON", CRANK_NICHOLSON) == 0;
+	if (!ok){
+		Py_DECREF(module);
+		return nullptr;
+	}
+	return module;
+}
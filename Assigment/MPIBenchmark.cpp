@@ -0,0 +1,117 @@
+/**
+* \file      MPIBenchmark.cpp
+* \author    m.leclech
+* \version   1.0
+* \date      19 October 2026
+* \brief     Strong and weak scaling of the schemes distributed with MPI.
+*
+* \details   For each scheme, the problem is solved on the processes of MPI_COMM_WORLD :
+*              - strong scaling : the wall has the same number of points whatever the
+*                number of processes
+*              - weak scaling : the wall has the same number of points per process
+*            The process 0 print the time of the distributed solve and, if the grid is
+*            not too large, the maximum difference with the HeatConduction classes.
+*            It is a separate program, built and run on local processes for example with :
+*            mpicxx -std=c++11 -O2 MPIBenchmark.cpp HeatConductionMPI.cpp HeatConduction.cpp FixedSizeSchemes.cpp -o MPIBenchmark
+*            for p in 1 2 4; do mpirun -np $p ./MPIBenchmark; done
+*/
+
+#include "HeatConductionMPI.h"
+#include "HeatConduction.h"
+#include <iostream>
+#include <iomanip>
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
+
+/**
+* \fn void run(const char *mode, int scheme, int s, int n, int check)
+* \brief Solve one problem on all the processes and print the results on the process 0
+*
+* The wall is 1 ft long and dx = 1/s. The time step is chosen so that r = 0.5, which is
+* stable for DuFort-Frankel, Laasonen and Crank-Nicholson, and Tend = n*dt. Richardson
+* is unstable for any r, so its solution grow without bound and only its time and its
+* relative difference are meaningful.
+*
+* \param mode - "strong" or "weak", printed
+* \param scheme - a value of the enum Scheme, except ANALYTICAL
+* \param s - the number of space steps of the whole wall
+* \param n - the number of time steps
+* \param check - the largest s for which the serial solve is made to check the result
+* \return void
+*/
+void run(const char *mode, int scheme, int s, int n, int check){
+	const char *names[5] = { "Analytical", "DuFort_Frankel", "Richardson", "Laasonen", "CrankNicholson" };
+	double D = 0.1;
+	double dx = 1.0 / s;
+	double dt = 0.5 * dx * dx / D;
+	double Tend = (n + 0.5) * dt; // int(Tend/dt) must give n, and int(Xmax/dx) must give s
+	double Xmax = 1 + 0.5 * dx;
+	int rank, size;
+	MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+	MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+	DistributedHeatConduction *problem;
+	if (scheme == DUFORT_FRANKEL || scheme == RICHARDSON){
+		problem = new DistributedExplicitMethod(MPI_COMM_WORLD, scheme, 100, 300, 0, Xmax, Tend, D, dx, dt);
+	}
+	else {
+		problem = new DistributedImplicitMethod(MPI_COMM_WORLD, scheme, 100, 300, 0, Xmax, Tend, D, dx, dt);
+	}
+
+	MPI_Barrier(MPI_COMM_WORLD);
+	double t1 = MPI_Wtime();
+	(*problem).solve();
+	MPI_Barrier(MPI_COMM_WORLD);
+	double t2 = MPI_Wtime();
+	std::vector<double> solution = (*problem).gather_u_n();
+
+	if (rank == 0){
+		std::cout << std::left << std::setw(7) << mode << std::setw(16) << names[scheme] << std::right;
+		std::cout << " processes " << std::setw(3) << size << " // s " << std::setw(8) << s << " // n " << std::setw(6) << n;
+		std::cout << std::fixed << std::setprecision(4) << " // time " << std::setw(9) << t2 - t1 << " s";
+		if (s <= check){
+			// Richardson is unstable : the difference is relative to the size of the solution
+			HeatConduction *serial = create_problem(scheme, 100, 300, 0, Xmax, Tend, D, dx, dt);
+			(*serial).solve();
+			std::vector<double> expected = (*serial).get_u_n();
+			double difference = 0;
+			double largest = 1;
+			for (int i = 0; i < int(expected.size()); i++){
+				difference = std::max(difference, std::fabs(solution[i] - expected[i]));
+				largest = std::max(largest, std::fabs(expected[i]));
+			}
+			std::cout << std::scientific << std::setprecision(1) << " // relative difference " << difference / largest;
+			delete serial;
+		}
+		std::cout << std::endl;
+	}
+	delete problem;
+}
+
+/**
+* \fn int main(int argc, char *argv[])
+* \brief Run the strong and weak scaling benchmarks
+*
+* \param argc - number of arguments
+* \param argv - [space steps for the strong scaling] [space steps per process for the weak scaling] [time steps] [largest s checked]
+* \return 0 - return a 0 if everything went ok.
+*/
+int main(int argc, char *argv[]){
+	MPI_Init(&argc, &argv);
+	int size;
+	MPI_Comm_size(MPI_COMM_WORLD, &size);
+	int strong = argc > 1 ? atoi(argv[1]) : 200000;
+	int weak = argc > 2 ? atoi(argv[2]) : 50000;
+	int n = argc > 3 ? atoi(argv[3]) : 200;
+	int check = argc > 4 ? atoi(argv[4]) : 1000000;
+
+	for (int scheme = DUFORT_FRANKEL; scheme <= CRANK_NICHOLSON; scheme++){
+		run("strong", scheme, strong, n, check);
+	}
+	for (int scheme = DUFORT_FRANKEL; scheme <= CRANK_NICHOLSON; scheme++){
+		run("weak", scheme, weak * size, n, check);
+	}
+	MPI_Finalize();
+	return 0;
+}
@@ -12,6 +12,7 @@
 */
 
 #include "Norms.h"
+#include <cmath>
 
 /**
 * \fn norm_one(std::vector<double> solution)
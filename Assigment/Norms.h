@@ -11,6 +11,8 @@
 *              - The uniform norm
 */
 
+#pragma once
+
 #include <vector>
 
 double norm_one(std::vector<double> solution);
@@ -0,0 +1,312 @@
+/**
+* \file      Parareal.cpp
+* \author    m.leclech
+* \version   1.0
+* \date      19 October 2026
+* \brief     Parallel in time integration of the Heat Conduction problem.
+*
+* \details   See Parareal.h for the algorithm.
+*/
+
+#include "Parareal.h"
+#include "Norms.h"
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+typedef std::chrono::high_resolution_clock Clock;
+
+/**
+* \fn double seconds(Clock::time_point t1, Clock::time_point t2)
+* \brief Time between two points, in seconds
+*
+* \param t1 - the start
+* \param t2 - the end
+* \return seconds - t2-t1
+*/
+static double seconds(Clock::time_point t1, Clock::time_point t2){
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count() * 1e-9;
+}
+
+/**
+* \fn double thread_seconds()
+* \brief CPU time used by the calling thread
+*
+* Unlike the wall clock it does not count the time the thread wait for a core, so
+* the fine solves are not slower when there are more workers than cores.
+*
+* \return seconds - the CPU time of the thread since its start
+*/
+static double thread_seconds(){
+#ifdef _WIN32
+	FILETIME creation, exit, kernel, user;
+	GetThreadTimes(GetCurrentThread(), &creation, &exit, &kernel, &user);
+	ULONGLONG kernelTime = (ULONGLONG(kernel.dwHighDateTime) << 32) | kernel.dwLowDateTime;
+	ULONGLONG userTime = (ULONGLONG(user.dwHighDateTime) << 32) | user.dwLowDateTime;
+	return (kernelTime + userTime) * 1e-7; // units of 100 ns
+#else
+	timespec now;
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+	return now.tv_sec + now.tv_nsec * 1e-9;
+#endif
+}
+
+/**
+* \fn Parareal::Parareal(double Tin_0, double Text_0, double Xmin, double Xmax, double Tend, double D, double dx, double fineDt, double coarseDt, int slices, int workers)
+* \brief Constructor of the Parareal class
+*
+* \param Tin_0 - initial condition Temperature inside
+* \param Text_0 - initial condition Temperature outside
+* \param Xmin - the X position far left
+* \param Xmax - the X position far right
+* \param Tend - the end time of the simulation
+* \param D - the difusivity of the wall
+* \param dx - the space step
+* \param fineDt - the time step of the Crank-Nicholson scheme, adjusted to the slices
+* \param coarseDt - the time step of the Laasonen scheme, adjusted to the slices
+* \param slices - the number of time slices
+* \param workers - the number of threads for the fine solves
+*/
+Parareal::Parareal(double Tin_0, double Text_0, double Xmin, double Xmax, double Tend, double D, double dx, double fineDt, double coarseDt, int slices, int workers){
+	this->Tin_0 = Tin_0;
+	this->Text_0 = Text_0;
+	this->Xmin = Xmin;
+	this->Xmax = Xmax;
+	this->D = D;
+	this->dx = dx;
+	this->slices = std::max(1, slices);
+	this->workers = std::max(1, workers);
+
+	// whole number of time steps in each slice
+	double sliceTime = Tend / this->slices;
+	fineSteps = std::max(1, int(sliceTime / fineDt + 0.5));
+	coarseSteps = std::max(1, int(sliceTime / coarseDt + 0.5));
+	this->fineDt = sliceTime / fineSteps;
+	this->coarseDt = sliceTime / coarseSteps;
+}
+
+/**
+* \fn std::vector<double> Parareal::propagate(int scheme, int steps, double dt, const std::vector<double> &u) const
+* \brief Solve a number of time steps with an implicit scheme, from a given solution
+*
+* \param scheme - LAASONEN or CRANK_NICHOLSON
+* \param steps - the number of time steps
+* \param dt - the time step
+* \param u - the solution at the start
+* \return u_n - the solution after the time steps
+*/
+std::vector<double> Parareal::propagate(int scheme, int steps, double dt, const std::vector<double> &u) const {
+	// Tend is in the middle of a time step so that int(Tend/dt) give steps
+	HeatConduction *problem = create_problem(scheme, Tin_0, Text_0, Xmin, Xmax, (steps + 0.5) * dt, D, dx, dt);
+	(*problem).set_u_n(u);
+	(*problem).solve();
+	std::vector<double> solution = (*problem).get_u_n();
+	delete problem;
+	return solution;
+}
+
+/**
+* \fn std::vector<double> Parareal::initial() const
+* \brief Initial condition of the problem
+*
+* \return u_n - Tin_0 inside the wall, Text_0 on the boundaries
+*/
+std::vector<double> Parareal::initial() const {
+	HeatConduction *problem = create_problem(LAASONEN, Tin_0, Text_0, Xmin, Xmax, coarseDt, D, dx, coarseDt);
+	std::vector<double> solution = (*problem).get_u_n();
+	delete problem;
+	return solution;
+}
+
+/**
+* \fn std::vector<double> Parareal::coarse(const std::vector<double> &u) const
+* \brief Coarse propagator : one slice with the Laasonen scheme
+*
+* \param u - the solution at the start of the slice
+* \return u_n - the solution at the end of the slice
+*/
+std::vector<double> Parareal::coarse(const std::vector<double> &u) const {
+	return propagate(LAASONEN, coarseSteps, coarseDt, u);
+}
+
+/**
+* \fn std::vector<double> Parareal::fine(const std::vector<double> &u) const
+* \brief Fine propagator : one slice with the Crank-Nicholson scheme
+*
+* \param u - the solution at the start of the slice
+* \return u_n - the solution at the end of the slice
+*/
+std::vector<double> Parareal::fine(const std::vector<double> &u) const {
+	return propagate(CRANK_NICHOLSON, fineSteps, fineDt, u);
+}
+
+/**
+* \fn PararealResult Parareal::solve(double tolerance, int maxIterations) const
+* \brief Solve with the Parareal algorithm
+*
+* After k iterations the k first slices have the fine solution, so their fine solves
+* are not made again, and the algorithm stop after as many iterations as slices. The
+* critical time is measured with the CPU time of the threads, so it does not depend
+* on the number of cores of this machine.
+*
+* \param tolerance - the largest correction of a slice, uniform norm, to stop
+* \param maxIterations - the largest number of iterations
+* \return result - the solution, the iterations and the times (serialTime and difference are set by compare)
+*/
+PararealResult Parareal::solve(double tolerance, int maxIterations) const {
+	PararealResult result;
+	result.iterations = 0;
+	result.converged = false;
+	result.correction = 0;
+	result.criticalTime = 0;
+	result.serialTime = -1;
+	result.difference = -1;
+	auto start = Clock::now();
+
+	std::vector<std::vector<double> > U(slices + 1); // solution at the start of each slice, and at Tend
+	std::vector<std::vector<double> > G(slices); // coarse solve of each slice
+	std::vector<std::vector<double> > F(slices); // fine solve of each slice
+	std::vector<double> fineTimes(slices);
+
+	// first coarse solve of all the slices
+	double t1 = thread_seconds();
+	U[0] = initial();
+	for (int j = 0; j < slices; j++){
+		G[j] = coarse(U[j]);
+		U[j + 1] = G[j];
+	}
+	result.criticalTime += thread_seconds() - t1;
+
+	for (int k = 0; k < std::min(maxIterations, slices); k++){
+		// fine solves of the slices not converged, on several threads
+		std::atomic<int> next(k);
+		auto work = [&](){
+			for (int j = next++; j < slices; j = next++){
+				double t2 = thread_seconds();
+				F[j] = fine(U[j]);
+				fineTimes[j] = thread_seconds() - t2;
+			}
+		};
+		std::vector<std::thread> threads;
+		for (int i = 0; i < std::min(workers, slices - k); i++){
+			threads.push_back(std::thread(work));
+		}
+		for (int i = 0; i < int(threads.size()); i++){
+			threads[i].join();
+		}
+		result.criticalTime += *std::max_element(fineTimes.begin() + k, fineTimes.end());
+		result.iterations = k + 1;
+
+		// correction, one slice after the other. The start of the slice k did not change, so its end is the fine solve
+		t1 = thread_seconds();
+		result.correction = 0;
+		for (int j = k; j < slices; j++){
+			std::vector<double> corrected;
+			if (j == k){
+				corrected = F[j];
+			}
+			else {
+				std::vector<double> coarseNew = coarse(U[j]);
+				corrected = coarseNew;
+				for (int i = 0; i < int(corrected.size()); i++){
+					corrected[i] += F[j][i] - G[j][i];
+				}
+				G[j] = coarseNew;
+			}
+			std::vector<double> change = corrected;
+			for (int i = 0; i < int(change.size()); i++){
+				change[i] -= U[j + 1][i];
+			}
+			result.correction = std::max(result.correction, norm_uniform(change));
+			U[j + 1] = corrected;
+		}
+		result.criticalTime += thread_seconds() - t1;
+
+		if (result.correction <= tolerance || k + 1 == slices){
+			result.converged = true;
+			break;
+		}
+	}
+
+	result.u_n = U[slices];
+	result.pararealTime = seconds(start, Clock::now());
+	return result;
+}
+
+/**
+* \fn void Parareal::compare(PararealResult &result) const
+* \brief Solve with the fine propagator on the whole time, and store its time and the difference with the Parareal solution
+*
+* \param result - a result of solve
+* \return void - the results are stored in result
+*/
+void Parareal::compare(PararealResult &result) const {
+	std::vector<double> u = initial();
+	auto t1 = Clock::now();
+	std::vector<double> serial = propagate(CRANK_NICHOLSON, slices * fineSteps, fineDt, u);
+	result.serialTime = seconds(t1, Clock::now());
+	for (int i = 0; i < int(serial.size()); i++){
+		serial[i] -= result.u_n[i];
+	}
+	result.difference = norm_uniform(serial);
+}
+
+/**
+* \fn int Parareal::get_fine_steps() const
+* \brief Get method of the attribute fineSteps
+*
+* \return fineSteps - the number of fine time steps in a slice
+*/
+int Parareal::get_fine_steps() const {
+	return fineSteps;
+}
+
+/**
+* \fn int Parareal::get_coarse_steps() const
+* \brief Get method of the attribute coarseSteps
+*
+* \return coarseSteps - the number of coarse time steps in a slice
+*/
+int Parareal::get_coarse_steps() const {
+	return coarseSteps;
+}
+
+/**
+* \fn int Parareal::get_slices() const
+* \brief Get method of the attribute slices
+*
+* \return slices - the number of time slices, at least 1
+*/
+int Parareal::get_slices() const {
+	return slices;
+}
+
+/**
+* \fn std::string parareal_report(const PararealResult &result, int slices)
+* \brief Text which describe a result of the Parareal algorithm, with the speedups over the serial fine solve
+*
+* \param result - a result of Parareal::solve, compared with Parareal::compare
+* \param slices - the number of time slices
+* \return report - the text, on several lines
+*/
+std::string parareal_report(const PararealResult &result, int slices){
+	std::ostringstream report;
+	report << "Iterations: " << result.iterations << " for " << slices << " slices // " << (result.converged ? "converged" : "not converged") << "\n";
+	report << std::scientific << std::setprecision(3);
+	report << "Last correction: " << result.correction << " // difference with the serial fine solve: " << result.difference << "\n";
+	report << "Time: serial fine " << result.serialTime << " s // Parareal " << result.pararealTime << " s";
+	report << " // one core per slice " << result.criticalTime << " s\n";
+	report << std::fixed << std::setprecision(2);
+	report << "Speedup: " << result.serialTime / result.pararealTime << " on this machine // ";
+	report << result.serialTime / result.criticalTime << " with one core per slice\n";
+	return report.str();
+}
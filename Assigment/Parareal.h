@@ -0,0 +1,76 @@
+/**
+* \file      Parareal.h
+* \author    m.leclech
+* \version   1.0
+* \date      19 October 2026
+* \brief     Parallel in time integration of the Heat Conduction problem.
+*
+* \details   For a long simulation on a small grid there is nothing to split in space,
+*            so the time is split in slices instead. The Parareal algorithm use :
+*              - a coarse propagator : the Laasonen scheme with a large time step, cheap,
+*                run one slice after the other
+*              - a fine propagator : the Crank-Nicholson scheme with a small time step,
+*                run on all the slices at the same time, one thread per slice
+*            At each iteration the start of each slice is corrected with
+*            U(j+1) = G(U(j)) + F(U(j)) - G(previous U(j)), until the correction is
+*            below the tolerance. After as many iterations as slices the result is the
+*            one of the serial fine solve, so the speedup come from converging before.
+*/
+
+#pragma once
+
+#include "HeatConduction.h"
+#include <vector>
+#include <string>
+
+/**
+* \struct PararealResult
+* \brief Solution of the Parareal algorithm, with its iterations and times
+*/
+struct PararealResult {
+	std::vector<double> u_n; //!< solution at Tend
+	int iterations; //!< number of iterations made
+	bool converged; //!< true if the correction went below the tolerance
+	double correction; //!< largest correction of a slice at the last iteration, uniform norm
+	double pararealTime; //!< time of the Parareal algorithm on this machine, in seconds
+	double criticalTime; //!< time with one core per slice : the slowest fine solve of each iteration plus the coarse solves, in seconds of CPU time of their threads
+	double serialTime; //!< time of the serial fine solve, in seconds
+	double difference; //!< difference with the serial fine solve, uniform norm
+};
+
+/**
+* \class Parareal
+* \brief Class which solve a problem with the Parareal algorithm
+*
+* The time steps are adjusted so that each slice has a whole number of fine and
+* coarse time steps. The slices are solved with the HeatConduction classes, which
+* start from the solution given with set_u_n.
+*/
+class Parareal {
+private:
+	double Tin_0; //!< initial condition Temperature
+	double Text_0; //!< initial condition Temperature
+	double Xmin; //!< initial condition Position
+	double Xmax; //!< initial condition Position
+	double D; //!< initial condition D
+	double dx; //!< space step
+	int slices; //!< number of time slices
+	int fineSteps; //!< number of fine time steps in a slice
+	int coarseSteps; //!< number of coarse time steps in a slice
+	double fineDt; //!< fine time step
+	double coarseDt; //!< coarse time step
+	int workers; //!< number of threads for the fine solves
+	std::vector<double> propagate(int scheme, int steps, double dt, const std::vector<double> &u) const;
+	std::vector<double> initial() const;
+public:
+	Parareal(double Tin_0, double Text_0, double Xmin, double Xmax, double Tend, double D, double dx, double fineDt, double coarseDt, int slices, int workers);
+	std::vector<double> coarse(const std::vector<double> &u) const;
+	std::vector<double> fine(const std::vector<double> &u) const;
+	PararealResult solve(double tolerance, int maxIterations) const;
+	void compare(PararealResult &result) const;
+	int get_fine_steps() const;
+	int get_coarse_steps() const;
+	int get_slices() const;
+};
+
+std::string parareal_report(const PararealResult &result, int slices);
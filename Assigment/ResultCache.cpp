@@ -0,0 +1,318 @@
+/**
+* \file      ResultCache.cpp
+* \author    m.leclech
+* \version   1.0
+* \date      19 October 2026
+* \brief     Cache of the solutions already calculated.
+*
+* \details   The solutions are stored with the key of the problem (scheme and
+*            parameters) in two tiers :
+*              - in memory, with a Least Recently Used policy
+*              - on the disk, optional, one file per problem named after the hash of the key
+*/
+
+#include "ResultCache.h"
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <cstdio>
+#include <thread>
+#include <chrono>
+#include <functional>
+
+/**
+* \fn unsigned long long hash_key(const std::string &key)
+* \brief Function to calculate the FNV-1a 64 bits hash of a key
+*
+* \param key - the key of a problem, given by HeatConduction::get_key()
+* \return hash - the hash of the key
+*/
+unsigned long long hash_key(const std::string &key) {
+	unsigned long long hash = 14695981039346656037ULL;
+	for (int i = 0; i < int(key.size()); i++){
+		hash ^= (unsigned char)key[i];
+		hash *= 1099511628211ULL;
+	}
+	return hash;
+}
+
+/**
+* \fn ResultCache::ResultCache(unsigned int capacity, std::string directory)
+* \brief Constructor of the ResultCache class
+*
+* \param capacity - the maximum number of solutions kept in memory
+* \param directory - an existing directory for the disk tier, empty to keep only the memory tier
+*/
+ResultCache::ResultCache(unsigned int capacity, std::string directory){
+	this->capacity = capacity;
+	this->directory = directory;
+	memoryHits = 0;
+	diskHits = 0;
+	misses = 0;
+}
+
+/**
+* \fn void ResultCache::solve(HeatConduction &problem)
+* \brief Solve the problem, or give back the solution if it is already known
+*
+* If the solution is found it is restored in the problem, otherwise the problem is
+* initialised and solved, so an implicit scheme already solved does not continue
+* from its last solution, and the solution is stored. A problem modified by set_u_n
+* does not start from the state described by its key, so it is solved without the
+* cache and counted as a miss.
+*
+* \param problem - the problem to solve
+* \return void - the result is stored in the vector u_n of the problem
+*/
+void ResultCache::solve(HeatConduction &problem){
+	if (problem.is_modified()){
+		{
+			std::lock_guard<std::mutex> guard(lock);
+			misses++;
+		}
+		problem.solve();
+		return;
+	}
+
+	std::string key = problem.get_key();
+	std::vector<double> solution;
+	if (find(key, problem.get_s() + 1, solution)){
+		problem.restore_u_n(solution);
+		return;
+	}
+
+	// the lock is released while solving, so other threads can use the cache
+	problem.initialise();
+	problem.solve();
+	add(key, problem.get_u_n_view());
+}
+
+/**
+* \fn bool ResultCache::find(const std::string &key, unsigned int size, std::vector<double> &solution)
+* \brief Look for a solution, in memory then on the disk
+*
+* The disk is read outside of the lock, so the threads only wait for each other
+* on the memory tier.
+*
+* \param key - the key of the problem, given by HeatConduction::get_key()
+* \param size - the size of the solution, s+1
+* \param solution - vector in which the solution is copied if it is found
+* \return found - true if the solution is known, otherwise it is counted as a miss
+*/
+bool ResultCache::find(const std::string &key, unsigned int size, std::vector<double> &solution){
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		std::unordered_map<std::string, std::list<Entry>::iterator>::iterator found = index.find(key);
+		if (found != index.end()){
+			entries.splice(entries.begin(), entries, found->second); // most recently used goes first
+			solution = found->second->second;
+			memoryHits++;
+			return true;
+		}
+	}
+
+	bool loaded = load(key, size, solution);
+	std::lock_guard<std::mutex> guard(lock);
+	if (!loaded){
+		misses++;
+		return false;
+	}
+	if (index.find(key) == index.end()){
+		insert(key, solution);
+	}
+	diskHits++;
+	return true;
+}
+
+/**
+* \fn void ResultCache::add(const std::string &key, const std::vector<double> &solution)
+* \brief Store a solution in memory, and on the disk if a directory was given
+*
+* \param key - the key of the problem, given by HeatConduction::get_key()
+* \param solution - the solution of the problem
+* \return void
+*/
+void ResultCache::add(const std::string &key, const std::vector<double> &solution){
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		if (index.find(key) != index.end()){
+			return; // solved by another thread in the meantime, and already stored
+		}
+		insert(key, solution);
+	}
+	store(key, solution);
+}
+
+/**
+* \fn void ResultCache::insert(const std::string &key, const std::vector<double> &solution)
+* \brief Add a solution in memory, and remove the least recently used one if the cache is full
+*
+* \param key - the key of the problem
+* \param solution - the solution of the problem
+* \return void
+*/
+void ResultCache::insert(const std::string &key, const std::vector<double> &solution){
+	if (capacity == 0){
+		return;
+	}
+	if (entries.size() >= capacity){
+		index.erase(entries.back().first);
+		entries.pop_back();
+	}
+	entries.push_front(Entry(key, solution));
+	index[key] = entries.begin();
+}
+
+/**
+* \fn std::string ResultCache::get_path(const std::string &key) const
+* \brief Path of the file of the disk tier corresponding to a key
+*
+* \param key - the key of the problem
+* \return path - the directory followed by the hash of the key in hexadecimal
+*/
+std::string ResultCache::get_path(const std::string &key) const {
+	std::ostringstream path;
+	path << directory << "/" << std::hex << std::setw(16) << std::setfill('0') << hash_key(key) << ".bin";
+	return path.str();
+}
+
+/**
+* \fn bool ResultCache::load(const std::string &key, unsigned int size, std::vector<double> &solution) const
+* \brief Read a solution from the disk tier
+*
+* The key is written in the file, so two keys with the same hash are not mixed up.
+* A file with a solution of another size is corrupt, and it is ignored.
+*
+* \param key - the key of the problem
+* \param size - the size of the solution, s+1
+* \param solution - vector in which the solution is read
+* \return found - true if the solution was on the disk
+*/
+bool ResultCache::load(const std::string &key, unsigned int size, std::vector<double> &solution) const {
+	if (directory.empty()){
+		return false;
+	}
+	std::ifstream file(get_path(key).c_str(), std::ios::binary);
+	if (!file){
+		return false;
+	}
+
+	unsigned int stored = 0;
+	file.read((char*)&stored, sizeof(stored));
+	if (!file || stored != key.size()){
+		return false;
+	}
+	std::string storedKey(stored, ' ');
+	file.read(&storedKey[0], stored);
+	if (!file || storedKey != key){
+		return false;
+	}
+
+	file.read((char*)&stored, sizeof(stored));
+	if (!file || stored != size || size == 0){
+		return false;
+	}
+	solution = std::vector<double>(size);
+	file.read((char*)&solution[0], size * sizeof(double));
+	return bool(file);
+}
+
+/**
+* \fn void ResultCache::store(const std::string &key, const std::vector<double> &solution) const
+* \brief Write a solution in the disk tier, if a directory was given
+*
+* The file is written under a temporary name and renamed once complete, so another
+* process never read a file half written.
+*
+* \param key - the key of the problem
+* \param solution - the solution of the problem
+* \return void - a file named after the hash of the key is written
+*/
+void ResultCache::store(const std::string &key, const std::vector<double> &solution) const {
+	if (directory.empty() || solution.empty()){
+		return;
+	}
+	std::string path = get_path(key);
+	std::ostringstream temporary;
+	temporary << path << "." << std::hex << std::hash<std::thread::id>()(std::this_thread::get_id());
+	temporary << "." << std::chrono::steady_clock::now().time_since_epoch().count() << ".tmp";
+	{
+		std::ofstream file(temporary.str().c_str(), std::ios::binary);
+		if (!file){
+			return;
+		}
+		unsigned int size = key.size();
+		file.write((const char*)&size, sizeof(size));
+		file.write(key.data(), size);
+		size = solution.size();
+		file.write((const char*)&size, sizeof(size));
+		file.write((const char*)&solution[0], size * sizeof(double));
+		if (!file){
+			file.close();
+			std::remove(temporary.str().c_str());
+			return;
+		}
+	}
+	if (std::rename(temporary.str().c_str(), path.c_str()) != 0){
+		std::remove(temporary.str().c_str()); // on Windows the file may already exist, written by another process
+	}
+}
+
+/**
+* \fn int ResultCache::get_hits() const
+* \brief Get method of the number of solutions found in the cache
+*
+* \return hits - the solutions found in memory or on the disk
+*/
+int ResultCache::get_hits() const {
+	std::lock_guard<std::mutex> guard(lock);
+	return memoryHits + diskHits;
+}
+
+/**
+* \fn int ResultCache::get_memory_hits() const
+* \brief Get method of the attribute memoryHits
+*
+* \return memoryHits - the solutions found in memory
+*/
+int ResultCache::get_memory_hits() const {
+	std::lock_guard<std::mutex> guard(lock);
+	return memoryHits;
+}
+
+/**
+* \fn int ResultCache::get_disk_hits() const
+* \brief Get method of the attribute diskHits
+*
+* \return diskHits - the solutions found on the disk
+*/
+int ResultCache::get_disk_hits() const {
+	std::lock_guard<std::mutex> guard(lock);
+	return diskHits;
+}
+
+/**
+* \fn int ResultCache::get_misses() const
+* \brief Get method of the attribute misses
+*
+* \return misses - the solutions which had to be calculated
+*/
+int ResultCache::get_misses() const {
+	std::lock_guard<std::mutex> guard(lock);
+	return misses;
+}
+
+/**
+* \fn void ResultCache::clear()
+* \brief Remove all the solutions in memory and reset the statistics. The disk tier is kept.
+*
+* \return void
+*/
+void ResultCache::clear(){
+	std::lock_guard<std::mutex> guard(lock);
+	entries.clear();
+	index.clear();
+	memoryHits = 0;
+	diskHits = 0;
+	misses = 0;
+}
@@ -0,0 +1,60 @@
+/**
+* \file      ResultCache.h
+* \author    m.leclech
+* \version   1.0
+* \date      19 October 2026
+* \brief     Cache of the solutions already calculated.
+*
+* \details   The solutions are stored with the key of the problem (scheme and
+*            parameters) in two tiers :
+*              - in memory, with a Least Recently Used policy
+*              - on the disk, optional, one file per problem named after the hash of the key
+*/
+
+#pragma once
+
+#include "HeatConduction.h"
+#include <vector>
+#include <string>
+#include <list>
+#include <unordered_map>
+#include <utility>
+#include <mutex>
+
+/**
+* \class ResultCache
+* \brief Class which store the solutions to avoid solving the same problem twice
+*
+* ResultCache keep the last solutions calculated in memory, and if a directory is
+* given, also write them on the disk so they can be used by the next launches of
+* the program. The solve method replace a call to the solve method of the problem.
+* The cache can be shared by several threads, the problems are solved outside of the lock.
+*/
+class ResultCache {
+private:
+	typedef std::pair<std::string, std::vector<double> > Entry;
+	unsigned int capacity; //!< maximum number of solutions kept in memory
+	std::string directory; //!< directory of the disk tier, empty if not used
+	std::list<Entry> entries; //!< solutions in memory, the most recently used first
+	std::unordered_map<std::string, std::list<Entry>::iterator> index; //!< position of each key in entries
+	int memoryHits; //!< number of solutions found in memory
+	int diskHits; //!< number of solutions found on the disk
+	int misses; //!< number of solutions which had to be calculated
+	mutable std::mutex lock; //!< protect the entries and the statistics
+	void insert(const std::string &key, const std::vector<double> &solution);
+	bool load(const std::string &key, unsigned int size, std::vector<double> &solution) const;
+	void store(const std::string &key, const std::vector<double> &solution) const;
+	std::string get_path(const std::string &key) const;
+public:
+	ResultCache(unsigned int capacity, std::string directory = "");
+	void solve(HeatConduction &problem);
+	bool find(const std::string &key, unsigned int size, std::vector<double> &solution);
+	void add(const std::string &key, const std::vector<double> &solution);
+	int get_hits() const;
+	int get_memory_hits() const;
+	int get_disk_hits() const;
+	int get_misses() const;
+	void clear();
+};
+
+unsigned long long hash_key(const std::string &key);
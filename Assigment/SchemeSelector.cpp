@@ -0,0 +1,514 @@
+/**
+* \file      SchemeSelector.cpp
+* \author    m.leclech
+* \version   1.0
+* \date      19 October 2026
+* \brief     Automatic choice of the scheme, the time step and the space step.
+*
+* \details   See SchemeSelector.h for the error and cost models.
+*/
+
+#include "SchemeSelector.h"
+#include "Norms.h"
+#include <cmath>
+#include <chrono>
+#include <limits>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+
+typedef std::chrono::high_resolution_clock Clock;
+
+const double pi = atan(1) * 4; //!< define pi
+const int maxTimeSteps = 1 << 20; //!< largest number of time steps tried
+const int calibrationSteps[6] = { 8, 16, 32, 64, 128, 256 }; //!< numbers of time steps of the microbenchmarks, in the range chosen by select for the usual targets
+const double calibrationBatch = 2e-4; //!< shortest time of a batch of solves timed together, in seconds
+const int calibrationBatches = 5; //!< batches timed for each microbenchmark
+const int maxRoundings = 64; //!< largest number of ulps removed from a step so that the classes find back s or n
+
+//
+// ...... STABILITY ANALYSIS ......
+//
+
+/**
+* \fn void recurrence(int scheme, double r, double theta, double &p, double &q)
+* \brief Coefficients of the recurrence a(n+1) = p a(n) + q a(n-1) followed by the amplitude of a sine mode
+*
+* For the two levels schemes q is 0 and p is the amplification factor.
+*
+* \param scheme - a value of the enum Scheme, except ANALYTICAL
+* \param r - D*dt/(dx*dx)
+* \param theta - the wave number of the mode times dx
+* \param p - the coefficient of a(n)
+* \param q - the coefficient of a(n-1)
+* \return void
+*/
+static void recurrence(int scheme, double r, double theta, double &p, double &q){
+	double lambda = 4 * pow(sin(theta / 2), 2); // eigenvalue of the second difference
+	q = 0;
+	switch (scheme){
+	case DUFORT_FRANKEL:
+		p = 4 * r * cos(theta) / (1 + 2 * r);
+		q = (1 - 2 * r) / (1 + 2 * r);
+		break;
+	case RICHARDSON:
+		p = -2 * r * lambda;
+		q = 1;
+		break;
+	case LAASONEN:
+		p = 1 / (1 + r * lambda);
+		break;
+	default:
+		p = (1 - r * lambda / 2) / (1 + r * lambda / 2);
+		break;
+	}
+}
+
+/**
+* \fn double amplification(int scheme, double r, double theta)
+* \brief Modulus of the largest amplification factor of a sine mode
+*
+* For the three levels schemes the amplification factors are the roots of G^2 = p G + q.
+*
+* \param scheme - a value of the enum Scheme, except ANALYTICAL
+* \param r - D*dt/(dx*dx)
+* \param theta - the wave number of the mode times dx
+* \return G - the modulus of the amplification factor
+*/
+double amplification(int scheme, double r, double theta){
+	double p, q;
+	recurrence(scheme, r, theta, p, q);
+	if (scheme == LAASONEN || scheme == CRANK_NICHOLSON){
+		return fabs(p);
+	}
+	double discriminant = p * p + 4 * q;
+	if (discriminant < 0){
+		return sqrt(-q); // complex conjugate roots, their product is -q
+	}
+	return (fabs(p) + sqrt(discriminant)) / 2;
+}
+
+/**
+* \fn bool is_stable(int scheme, double r, int s)
+* \brief Von Neumann stability of a scheme on a grid of s space steps
+*
+* \param scheme - a value of the enum Scheme, except ANALYTICAL
+* \param r - D*dt/(dx*dx)
+* \param s - the number of space steps
+* \return stable - true if no mode of the grid is amplified
+*/
+bool is_stable(int scheme, double r, int s){
+	for (int k = 1; k < s; k++){
+		if (amplification(scheme, r, k * pi / s) > 1 + 1e-12){
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+* \fn double amplitude(int scheme, double r, double theta, int n, double c)
+* \brief Amplitude of a sine mode after n time steps
+*
+* The three levels schemes start with u_nminus1 = u_n, so a(-1) = a(0) = c, and
+* the recurrence is calculated with the powers of its matrix.
+*
+* \param scheme - a value of the enum Scheme, except ANALYTICAL
+* \param r - D*dt/(dx*dx)
+* \param theta - the wave number of the mode times dx
+* \param n - the number of time steps
+* \param c - the amplitude at the start
+* \return a - the amplitude after n time steps
+*/
+static double amplitude(int scheme, double r, double theta, int n, double c){
+	double p, q;
+	recurrence(scheme, r, theta, p, q);
+	if (scheme == LAASONEN || scheme == CRANK_NICHOLSON){
+		return c * pow(p, n);
+	}
+	double power[4] = { 1, 0, 0, 1 }; // M^n, M = [p q ; 1 0]
+	double square[4] = { p, q, 1, 0 };
+	for (int k = n; k > 0; k /= 2){
+		double product[4];
+		if (k % 2 == 1){
+			product[0] = power[0] * square[0] + power[1] * square[2];
+			product[1] = power[0] * square[1] + power[1] * square[3];
+			product[2] = power[2] * square[0] + power[3] * square[2];
+			product[3] = power[2] * square[1] + power[3] * square[3];
+			std::copy(product, product + 4, power);
+		}
+		product[0] = square[0] * square[0] + square[1] * square[2];
+		product[1] = square[0] * square[1] + square[1] * square[3];
+		product[2] = square[2] * square[0] + square[3] * square[2];
+		product[3] = square[2] * square[1] + square[3] * square[3];
+		std::copy(product, product + 4, square);
+	}
+	return (power[0] + power[1]) * c;
+}
+
+//
+// ...... SELECTOR ......
+//
+
+/**
+* \fn SchemeSelector::SchemeSelector(double Tin_0, double Text_0, double Xmin, double Xmax, double Tend, double D, int norm)
+* \brief Constructor of the SchemeSelector class, which calibrate the cost model on this machine
+*
+* \param Tin_0 - initial condition Temperature inside
+* \param Text_0 - initial condition Temperature outside
+* \param Xmin - the X position far left
+* \param Xmax - the X position far right
+* \param Tend - the end time of the simulation
+* \param D - the difusivity of the wall
+* \param norm - a value of the enum Norm, used for the error
+*
+* The cost model is not calibrated if the parameters are not valid, then select find nothing.
+*/
+SchemeSelector::SchemeSelector(double Tin_0, double Text_0, double Xmin, double Xmax, double Tend, double D, int norm){
+	this->Tin_0 = Tin_0;
+	this->Text_0 = Text_0;
+	this->Xmin = Xmin;
+	this->Xmax = Xmax;
+	this->Tend = Tend;
+	this->D = D;
+	this->norm = norm;
+	int sizes[10] = { 10, 20, 40, 50, 80, 100, 160, 200, 320, 400 };
+	grids = std::vector<int>(sizes, sizes + 10);
+	if (is_valid()){
+		calibrate();
+	}
+}
+
+/**
+* \fn bool SchemeSelector::is_valid() const
+* \brief Check the parameters given to the constructor
+*
+* \return valid - true if Tend, D and Xmax-Xmin are positive and the norm is a value of the enum Norm
+*/
+bool SchemeSelector::is_valid() const {
+	return Tend > 0 && D > 0 && Xmax > Xmin && norm >= NORM_ONE && norm <= NORM_UNIFORM;
+}
+
+/**
+* \fn double SchemeSelector::measure(int scheme, int s, int n) const
+* \brief Microbenchmark of a solve, the median of several batches of solves
+*
+* The short solves are repeated until a batch takes calibrationBatch, so the
+* resolution of the clock and the noise of a single solve are averaged out.
+*
+* \param scheme - a value of the enum Scheme
+* \param s - the number of space steps
+* \param n - the number of time steps
+* \return time - the time of one solve in seconds, without the creation of the problem
+*/
+double SchemeSelector::measure(int scheme, int s, int n) const {
+	HeatConduction *problem = create_problem(scheme, Tin_0, Text_0, Xmin, Xmax, Tend, D, get_dx(s), get_dt(n));
+	int repeats = 1;
+	std::vector<double> times;
+	while (int(times.size()) < calibrationBatches){
+		auto t1 = Clock::now();
+		for (int k = 0; k < repeats; k++){
+			(*problem).initialise();
+			(*problem).solve();
+		}
+		auto t2 = Clock::now();
+		double time = std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count() * 1e-9;
+		if (times.empty() && time < calibrationBatch && repeats < (1 << 20)){
+			repeats *= 2; // the batch is still too short, it is not kept
+			continue;
+		}
+		times.push_back(time / repeats);
+	}
+	delete problem;
+	std::sort(times.begin(), times.end());
+	return times[times.size() / 2];
+}
+
+/**
+* \fn void SchemeSelector::calibrate()
+* \brief Calibrate the cost model : a solve of n time steps take solveCost + n*stepCost
+*
+* Each scheme is measured on each grid with the numbers of time steps of calibrationSteps,
+* so the specialized schemes of FixedSizeSchemes.h and the effects of the caches are in
+* the model, and the two costs are fitted by least squares on these measures. The largest
+* relative residual of the fit is kept in costSpread.
+*
+* \return void
+*/
+void SchemeSelector::calibrate(){
+	stepCost = std::vector<std::vector<double> >(CRANK_NICHOLSON + 1, std::vector<double>(grids.size(), 0.0));
+	solveCost = stepCost;
+	costSpread = stepCost;
+	const int points = sizeof(calibrationSteps) / sizeof(calibrationSteps[0]);
+	for (int scheme = DUFORT_FRANKEL; scheme <= CRANK_NICHOLSON; scheme++){
+		for (int g = 0; g < int(grids.size()); g++){
+			double times[points];
+			double meanSteps = 0, meanTime = 0;
+			for (int k = 0; k < points; k++){
+				times[k] = measure(scheme, grids[g], calibrationSteps[k]);
+				meanSteps += double(calibrationSteps[k]) / points;
+				meanTime += times[k] / points;
+			}
+			double covariance = 0, variance = 0;
+			for (int k = 0; k < points; k++){
+				covariance += (calibrationSteps[k] - meanSteps) * (times[k] - meanTime);
+				variance += (calibrationSteps[k] - meanSteps) * (calibrationSteps[k] - meanSteps);
+			}
+			stepCost[scheme][g] = std::max(0.0, covariance / variance);
+			solveCost[scheme][g] = std::max(0.0, meanTime - stepCost[scheme][g] * meanSteps);
+			for (int k = 0; k < points; k++){
+				double fit = solveCost[scheme][g] + stepCost[scheme][g] * calibrationSteps[k];
+				costSpread[scheme][g] = std::max(costSpread[scheme][g], fabs(fit - times[k]) / times[k]);
+			}
+		}
+	}
+}
+
+/**
+* \fn double SchemeSelector::get_dx(int s) const
+* \brief Space step for s space steps, rounded down so that the HeatConduction classes find s again
+*
+* \param s - the number of space steps
+* \return dx - the space step
+*/
+double SchemeSelector::get_dx(int s) const {
+	double dx = (Xmax - Xmin) / s;
+	for (int k = 0; k < maxRoundings && int((Xmax - Xmin) / dx) < s; k++){
+		dx = std::nextafter(dx, 0.0);
+	}
+	return dx;
+}
+
+/**
+* \fn double SchemeSelector::get_dt(int n) const
+* \brief Time step for n time steps, rounded down so that the HeatConduction classes find n again
+*
+* \param n - the number of time steps
+* \return dt - the time step
+*/
+double SchemeSelector::get_dt(int n) const {
+	double dt = Tend / n;
+	for (int k = 0; k < maxRoundings && int(Tend / dt) < n; k++){
+		dt = std::nextafter(dt, 0.0);
+	}
+	return dt;
+}
+
+/**
+* \fn std::vector<int> SchemeSelector::get_grids() const
+* \brief Get method of the attribute grids
+*
+* \return grids - the numbers of space steps tried
+*/
+std::vector<int> SchemeSelector::get_grids() const {
+	return grids;
+}
+
+/**
+* \fn double SchemeSelector::error(const std::vector<double> &solution, double dx, double dt) const
+* \brief Norm of the difference between a solution and the AnalyticalSolution
+*
+* \param solution - the solution of size s+1
+* \param dx - the space step of the solution
+* \param dt - the time step of the solution
+* \return error - the norm chosen of the error point by point
+*/
+double SchemeSelector::error(const std::vector<double> &solution, double dx, double dt) const {
+	AnalyticalSolution reference(Tin_0, Text_0, Xmin, Xmax, Tend, D, dx, dt);
+	reference.solve();
+	std::vector<double> difference = reference.get_u_n();
+	for (int i = 0; i < int(difference.size()); i++){
+		difference[i] = solution[i] - difference[i];
+	}
+	if (norm == NORM_ONE){
+		return norm_one(difference);
+	}
+	if (norm == NORM_TWO){
+		return norm_two(difference);
+	}
+	return norm_uniform(difference);
+}
+
+/**
+* \fn double SchemeSelector::predict_error(int scheme, int s, int n) const
+* \brief Error predicted without solving, with the amplification of each sine mode
+*
+* The initial condition, minus Text_0, is Tin_0-Text_0 inside the wall and 0 on the
+* boundaries. On the grid it is the sum of the modes k odd with the amplitudes
+* 2/s (Tin_0-Text_0) / tan(k pi/2s). The scheme ANALYTICAL give the limit of an
+* infinitely small time step, with the exact decay of each mode.
+*
+* \param scheme - a value of the enum Scheme
+* \param s - the number of space steps
+* \param n - the number of time steps
+* \return error - the norm chosen of the predicted error, infinite if the scheme overflow
+*/
+double SchemeSelector::predict_error(int scheme, int s, int n) const {
+	double dx = get_dx(s);
+	double dt = get_dt(n);
+	double r = (D*dt) / (dx*dx);
+
+	std::vector<double> sines(2 * s); // sin(m pi/s), enough for all the products k*j
+	for (int m = 0; m < 2 * s; m++){
+		sines[m] = sin(m * pi / s);
+	}
+	std::vector<double> solution(s + 1, Text_0);
+	for (int k = 1; k < s; k += 2){
+		double theta = k * pi / s;
+		double c = 2 * (Tin_0 - Text_0) / (s * tan(theta / 2));
+		double a;
+		if (scheme == ANALYTICAL){
+			a = c * exp(-D * 4 * pow(sin(theta / 2), 2) / (dx * dx) * Tend);
+		}
+		else {
+			a = amplitude(scheme, r, theta, n, c);
+		}
+		if (!std::isfinite(a)){
+			return std::numeric_limits<double>::infinity();
+		}
+		for (int j = 1; j < s; j++){
+			solution[j] += a * sines[(k * j) % (2 * s)];
+		}
+	}
+	return error(solution, dx, dt);
+}
+
+/**
+* \fn double SchemeSelector::predict_time(int scheme, int s, int n) const
+* \brief Time of a solve predicted by the cost model
+*
+* For a grid which was not calibrated, the costs of the closest smaller grid are
+* scaled by the number of points.
+*
+* \param scheme - a value of the enum Scheme, except ANALYTICAL
+* \param s - the number of space steps
+* \param n - the number of time steps
+* \return time - the predicted time in seconds
+*/
+double SchemeSelector::predict_time(int scheme, int s, int n) const {
+	int g = 0;
+	for (int k = 0; k < int(grids.size()); k++){
+		if (grids[k] <= s){
+			g = k;
+		}
+	}
+	double scale = double(s - 1) / (grids[g] - 1);
+	return solveCost[scheme][g] + n * stepCost[scheme][g] * scale;
+}
+
+/**
+* \fn Selection SchemeSelector::select(double target) const
+* \brief Choose the cheapest scheme, space step and time step for which the predicted error is below the target
+*
+* For each scheme and each grid, the number of time steps is doubled until the scheme
+* is stable and the predicted error is below the target, then refined by bisection.
+* The grids for which even the exact time integration is above the target are skipped.
+*
+* \param target - the largest error allowed, in the norm given to the constructor
+* \return selection - the choice, with found = false if the target cannot be reached or the parameters are not valid
+*/
+Selection SchemeSelector::select(double target) const {
+	Selection best;
+	best.found = false;
+	best.achievedError = -1;
+	best.achievedTime = -1;
+	if (!is_valid() || !(target > 0)){
+		return best;
+	}
+	for (int g = 0; g < int(grids.size()); g++){
+		int s = grids[g];
+		if (predict_error(ANALYTICAL, s, 1) > target){
+			continue;
+		}
+		for (int scheme = DUFORT_FRANKEL; scheme <= CRANK_NICHOLSON; scheme++){
+			double dx = get_dx(s);
+			int n = 1;
+			double predicted = 0;
+			while (n <= maxTimeSteps){
+				if (is_stable(scheme, (D*get_dt(n)) / (dx*dx), s)){
+					predicted = predict_error(scheme, s, n);
+					if (predicted <= target){
+						break;
+					}
+				}
+				n *= 2;
+			}
+			if (n > maxTimeSteps){
+				continue;
+			}
+			int low = n / 2;
+			while (n - low > 1){
+				int middle = (low + n) / 2;
+				double error = predict_error(scheme, s, middle);
+				if (is_stable(scheme, (D*get_dt(middle)) / (dx*dx), s) && error <= target){
+					n = middle;
+					predicted = error;
+				}
+				else {
+					low = middle;
+				}
+			}
+			double time = predict_time(scheme, s, n);
+			if (!best.found || time < best.predictedTime){
+				best.found = true;
+				best.scheme = scheme;
+				best.s = s;
+				best.n = n;
+				best.dx = dx;
+				best.dt = get_dt(n);
+				best.predictedError = predicted;
+				best.predictedTime = time;
+				best.timeSpread = costSpread[scheme][g];
+			}
+		}
+	}
+	return best;
+}
+
+/**
+* \fn void SchemeSelector::run(Selection &selection) const
+* \brief Solve the problem chosen, and store the achieved error and time
+*
+* The time is measured like the microbenchmarks of the cost model, so both can be compared.
+*
+* \param selection - a selection found by select
+* \return void - the results are stored in the selection
+*/
+void SchemeSelector::run(Selection &selection) const {
+	HeatConduction *problem = create_problem(selection.scheme, Tin_0, Text_0, Xmin, Xmax, Tend, D, selection.dx, selection.dt);
+	(*problem).solve();
+	selection.achievedError = error((*problem).get_u_n_view(), selection.dx, selection.dt);
+	delete problem;
+	selection.achievedTime = measure(selection.scheme, selection.s, selection.n);
+}
+
+/**
+* \fn std::string selection_report(const Selection &selection, double target)
+* \brief Text which describe a selection, with the predicted and achieved results
+*
+* \param selection - a selection found by SchemeSelector::select, and run if the achieved results are needed
+* \param target - the target error given to select
+* \return report - the text, on several lines
+*/
+std::string selection_report(const Selection &selection, double target){
+	const char *names[5] = { "Analytical", "DuFort_Frankel", "Richardson", "Laasonen", "CrankNicholson" };
+	std::ostringstream report;
+	if (!selection.found){
+		report << "No stable scheme reach the error " << target << " on the grids tried\n";
+		return report.str();
+	}
+	report << "Scheme: " << names[selection.scheme] << "\n";
+	report << "Space steps: " << selection.s << " // dx = " << selection.dx << "\n";
+	report << "Time steps: " << selection.n << " // dt = " << selection.dt << "\n";
+	report << std::scientific << std::setprecision(3);
+	report << "Error: target " << target << " // predicted " << selection.predictedError;
+	if (selection.achievedError >= 0){
+		report << " // achieved " << selection.achievedError;
+	}
+	report << "\nTime: predicted " << selection.predictedTime << " s (spread of the cost model " << std::fixed << std::setprecision(1) << 100 * selection.timeSpread << " %)" << std::scientific << std::setprecision(3);
+	if (selection.achievedTime >= 0){
+		report << " // achieved " << selection.achievedTime << " s";
+	}
+	report << "\n";
+	return report.str();
+}
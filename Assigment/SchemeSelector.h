@@ -0,0 +1,87 @@
+/**
+* \file      SchemeSelector.h
+* \author    m.leclech
+* \version   1.0
+* \date      19 October 2026
+* \brief     Automatic choice of the scheme, the time step and the space step.
+*
+* \details   For a target error, in one of the 3 norms, the selector look for the
+*            cheapest scheme, dt and dx which reach it :
+*              - the error is predicted with the Von Neumann analysis : the initial
+*                condition is split in sine modes on the grid, each mode is multiplied
+*                by the amplification factor of the scheme at each time step, and the
+*                result is compared with the AnalyticalSolution. The schemes with an
+*                amplification factor greater than 1 (Richardson) are unstable and left out.
+*              - the time of a solve is predicted with a cost model, fitted by least
+*                squares on microbenchmarks of each scheme on each grid, with a few
+*                numbers of time steps, when the selector is created.
+*            The chosen problem is then solved to report the achieved error and time.
+*/
+
+#pragma once
+
+#include "HeatConduction.h"
+#include <vector>
+#include <string>
+
+enum Norm {NORM_ONE=0, NORM_TWO=1, NORM_UNIFORM=2};
+
+/**
+* \struct Selection
+* \brief Scheme and steps chosen by the SchemeSelector, with the predicted and achieved results
+*/
+struct Selection {
+	bool found; //!< false if no stable scheme reach the target on the grids tried
+	int scheme; //!< a value of the enum Scheme
+	int s; //!< number of space steps
+	int n; //!< number of time steps
+	double dx; //!< space step
+	double dt; //!< time step
+	double predictedError; //!< error predicted by the Von Neumann analysis
+	double predictedTime; //!< time of a solve predicted by the cost model, in seconds
+	double timeSpread; //!< largest relative difference between the cost model and its microbenchmarks, for the scheme and grid chosen
+	double achievedError; //!< error of the solution, once solved
+	double achievedTime; //!< time of a solve, once solved, in seconds
+};
+
+/**
+* \class SchemeSelector
+* \brief Class which choose the cheapest scheme, time step and space step for a target error
+*
+* The space steps tried are dx = (Xmax-Xmin)/s for the values of s in the attribute grids.
+* For each stable scheme and each grid, the number of time steps is the smallest one
+* found for which the predicted error is below the target, and the cheapest of all these
+* choices is kept. The error is measured against the AnalyticalSolution, like in the
+* assigment, so a target below the accuracy of its series cannot be reached.
+*/
+class SchemeSelector {
+private:
+	double Tin_0; //!< initial condition Temperature
+	double Text_0; //!< initial condition Temperature
+	double Xmin; //!< initial condition Position
+	double Xmax; //!< initial condition Position
+	double Tend; //!< initial condition Time
+	double D; //!< initial condition D
+	int norm; //!< a value of the enum Norm
+	std::vector<int> grids; //!< numbers of space steps tried
+	std::vector<std::vector<double> > stepCost; //!< time of one time step, for each scheme and each grid
+	std::vector<std::vector<double> > solveCost; //!< time of a solve without any time step, for each scheme and each grid
+	std::vector<std::vector<double> > costSpread; //!< largest relative residual of the fit of the costs, for each scheme and each grid
+	void calibrate();
+	double measure(int scheme, int s, int n) const;
+	double error(const std::vector<double> &solution, double dx, double dt) const;
+public:
+	SchemeSelector(double Tin_0, double Text_0, double Xmin, double Xmax, double Tend, double D, int norm = NORM_UNIFORM);
+	bool is_valid() const;
+	double predict_error(int scheme, int s, int n) const;
+	double predict_time(int scheme, int s, int n) const;
+	Selection select(double target) const;
+	void run(Selection &selection) const;
+	double get_dx(int s) const;
+	double get_dt(int n) const;
+	std::vector<int> get_grids() const;
+};
+
+double amplification(int scheme, double r, double theta);
+bool is_stable(int scheme, double r, int s);
+std::string selection_report(const Selection &selection, double target);
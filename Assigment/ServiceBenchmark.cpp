@@ -0,0 +1,160 @@
+/**
+* \file      ServiceBenchmark.cpp
+* \author    m.leclech
+* \version   1.0
+* \date      19 October 2026
+* \brief     Throughput and latency benchmark of the local solver service.
+*
+* \details   The benchmark start a SolverService on a thread of its own process, then
+*            send batches of jobs with a SolverClient :
+*              - cold batches, where every job is new and has to be solved
+*              - warm batches, where the same jobs are asked again and come from the cache
+*            It is a separate program, built on POSIX systems with for example :
+*            g++ -std=c++11 -O2 -pthread ServiceBenchmark.cpp SolverService.cpp SolverClient.cpp ResultCache.cpp HeatConduction.cpp FixedSizeSchemes.cpp -o ServiceBenchmark
+*/
+
+#include "SolverService.h"
+#include "SolverClient.h"
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <thread>
+#include <chrono>
+#include <cstdlib>
+
+typedef std::chrono::high_resolution_clock Clock;
+
+/**
+* \fn std::vector<SolveRequest> make_batch(int first, int jobs)
+* \brief Create a batch of jobs on the problem of the assigment, rotating the 4 schemes
+*
+* \param first - number of the first job, each number give a different dt
+* \param jobs - the number of jobs in the batch
+* \return batch - the jobs, each one with the output times 0.1h -> 0.5h
+*/
+std::vector<SolveRequest> make_batch(int first, int jobs){
+	std::vector<SolveRequest> batch(jobs);
+	for (int j = 0; j < jobs; j++){
+		SolveRequest &request = batch[j];
+		request.scheme = DUFORT_FRANKEL + (first + j) % 4;
+		request.Tin_0 = 100;
+		request.Text_0 = 300;
+		request.Xmin = 0;
+		request.Xmax = 1;
+		request.D = 0.1;
+		request.dx = 0.05;
+		request.dt = 0.001 + 1e-7 * (first + j);
+		for (int i = 1; i < 6; i++){
+			request.times.push_back(double(i) / 10.0);
+		}
+	}
+	return batch;
+}
+
+/**
+* \fn void report(std::string name, std::vector<double> latencies, int jobs)
+* \brief Print the latencies and the throughput of a serie of batches
+*
+* \param name - the name of the serie
+* \param latencies - the time of each batch, in microseconds
+* \param jobs - the number of jobs in a batch
+* \return void
+*/
+void report(std::string name, std::vector<double> latencies, int jobs){
+	std::sort(latencies.begin(), latencies.end());
+	double total = 0;
+	for (int i = 0; i < int(latencies.size()); i++){
+		total += latencies[i];
+	}
+	int size = latencies.size();
+	std::cout << std::fixed << std::setprecision(1);
+	std::cout << name << " : mean " << total / size << " us // p50 " << latencies[size / 2] << " us // p99 " << latencies[std::min(size - 1, (99 * size) / 100)] << " us";
+	std::cout << " // " << (size * jobs) / (total * 1e-6) << " jobs/s" << std::endl;
+}
+
+/**
+* \fn int main(int argc, char *argv[])
+* \brief Run the benchmark
+*
+* \param argc - number of arguments
+* \param argv - [socket path] [number of batches] [jobs per batch] [workers]
+* \return 0 - return a 0 if everything went ok.
+*/
+int main(int argc, char *argv[]){
+	std::string path = argc > 1 ? argv[1] : "/tmp/heatconduction-bench.sock";
+	int batches = argc > 2 ? atoi(argv[2]) : 200;
+	int jobs = argc > 3 ? atoi(argv[3]) : 8;
+	int threads = argc > 4 ? atoi(argv[4]) : int(std::thread::hardware_concurrency());
+	if (batches < 1 || jobs < 1){
+		std::cerr << "Usage: ServiceBenchmark [socket path] [batches] [jobs per batch] [workers]" << std::endl;
+		return 1;
+	}
+
+	SolverService service(path, threads, batches * jobs * 5);
+	std::thread daemon([&service](){ service.run(); });
+
+	// wait for the service to listen
+	SolverClient *client = new SolverClient(path);
+	for (int attempt = 0; attempt < 100 && !(*client).is_connected(); attempt++){
+		delete client;
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		client = new SolverClient(path);
+	}
+	if (!(*client).is_connected()){
+		std::cerr << "Cannot connect to " << path << std::endl;
+		delete client;
+		return 1;
+	}
+
+	std::cout << "Benchmark: " << batches << " batches of " << jobs << " jobs (5 output times each), " << threads << " workers" << std::endl;
+	std::vector<SolveResult> results;
+	for (int pass = 0; pass < 2; pass++){
+		std::vector<double> latencies;
+		for (int b = 0; b < batches; b++){
+			std::vector<SolveRequest> batch = make_batch(b * jobs, jobs);
+			auto t1 = Clock::now();
+			bool ok = (*client).solve(batch, results);
+			auto t2 = Clock::now();
+			if (!ok){
+				std::cerr << "Connection lost" << std::endl;
+				return 1;
+			}
+			latencies.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count() / 1000.0);
+		}
+		report(pass == 0 ? "Cold" : "Warm", latencies, jobs);
+	}
+
+	// same jobs solved one by one in this process, without the service : like the
+	// workers, one march from t = 0 per job with a snapshot at each output time
+	auto t1 = Clock::now();
+	for (int b = 0; b < batches; b++){
+		std::vector<SolveRequest> batch = make_batch(b * jobs, jobs);
+		for (int j = 0; j < jobs; j++){
+			SolveRequest &request = batch[j];
+			std::vector<double> times = request.times;
+			std::sort(times.begin(), times.end());
+			std::vector<std::vector<double> > solutions(times.size());
+			HeatConduction *problem = create_problem(request.scheme, request.Tin_0, request.Text_0, request.Xmin, request.Xmax, times[0], request.D, request.dx, request.dt);
+			(*problem).initialise();
+			int done = 0;
+			for (int i = 0; i < int(times.size()); i++){
+				(*problem).set_parameters(request.Tin_0, request.Text_0, request.Xmin, request.Xmax, times[i], request.D, request.dx, request.dt);
+				(*problem).march((*problem).get_n() - done);
+				done = (*problem).get_n();
+				solutions[i] = (*problem).get_u_n();
+			}
+			delete problem;
+		}
+	}
+	auto t2 = Clock::now();
+	double serial = std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count() * 1e-9;
+	std::cout << "Serial in process : " << (batches * jobs) / serial << " jobs/s" << std::endl;
+
+	const ResultCache &cache = service.get_cache();
+	std::cout << "Cache: " << cache.get_hits() << " hits // " << cache.get_misses() << " misses" << std::endl;
+
+	(*client).stop_service();
+	delete client;
+	daemon.join();
+	return 0;
+}
@@ -0,0 +1,112 @@
+/**
+* \file      SolverClient.cpp
+* \author    m.leclech
+* \version   1.0
+* \date      19 October 2026
+* \brief     Client of the local solver service.
+*
+* \details   The client keep its connection open, so several batches can be
+*            sent one after the other without reconnecting.
+*/
+
+#include "SolverClient.h"
+
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <cstring>
+#endif
+
+/**
+* \fn SolverClient::SolverClient(std::string path)
+* \brief Constructor of the SolverClient class, which connect to the service
+*
+* \param path - the path of the Unix domain socket of the service
+*/
+SolverClient::SolverClient(std::string path){
+	connection = -1;
+#ifndef _WIN32
+	sockaddr_un address;
+	memset(&address, 0, sizeof(address));
+	address.sun_family = AF_UNIX;
+	if (path.size() >= sizeof(address.sun_path)){
+		return;
+	}
+	strcpy(address.sun_path, path.c_str());
+
+	connection = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (connection >= 0 && connect(connection, (sockaddr*)&address, sizeof(address)) < 0){
+		close(connection);
+		connection = -1;
+	}
+#endif
+}
+
+/**
+* \fn SolverClient::~SolverClient()
+* \brief Destructor of the SolverClient class, which close the connection
+*/
+SolverClient::~SolverClient(){
+#ifndef _WIN32
+	if (connection >= 0){
+		close(connection);
+	}
+#endif
+}
+
+/**
+* \fn bool SolverClient::is_connected() const
+* \brief Tell if the connection to the service is open
+*
+* \return connected - false if the service could not be reached
+*/
+bool SolverClient::is_connected() const {
+	return connection >= 0;
+}
+
+/**
+* \fn bool SolverClient::solve(const std::vector<SolveRequest> &requests, std::vector<SolveResult> &results)
+* \brief Send a batch of jobs and wait for all the results
+*
+* \param requests - the jobs of the batch
+* \param results - one result per job, in the same order
+* \return ok - false if the connection failed
+*/
+bool SolverClient::solve(const std::vector<SolveRequest> &requests, std::vector<SolveResult> &results){
+	if (connection < 0){
+		return false;
+	}
+	unsigned int op = SERVICE_SOLVE;
+	unsigned int size = requests.size();
+	if (!write_all(connection, &op, sizeof(op)) || !write_all(connection, &size, sizeof(size))){
+		return false;
+	}
+	for (int i = 0; i < int(size); i++){
+		if (!write_request(connection, requests[i])){
+			return false;
+		}
+	}
+
+	results = std::vector<SolveResult>(size);
+	for (int i = 0; i < int(size); i++){
+		if (!read_result(connection, requests[i], results[i])){
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+* \fn bool SolverClient::stop_service()
+* \brief Ask the service to stop once all its connections are closed
+*
+* \return ok - false if the connection failed
+*/
+bool SolverClient::stop_service(){
+	if (connection < 0){
+		return false;
+	}
+	unsigned int op = SERVICE_STOP;
+	return write_all(connection, &op, sizeof(op));
+}
@@ -0,0 +1,31 @@
+/**
+* \file      SolverClient.h
+* \author    m.leclech
+* \version   1.0
+* \date      19 October 2026
+* \brief     Client of the local solver service.
+*
+* \details   The client keep its connection open, so several batches can be
+*            sent one after the other without reconnecting.
+*/
+
+#pragma once
+
+#include "SolverService.h"
+#include <vector>
+#include <string>
+
+/**
+* \class SolverClient
+* \brief Class which send batches of jobs to a SolverService and read the results
+*/
+class SolverClient {
+private:
+	int connection; //!< socket connected to the service, -1 if not connected
+public:
+	SolverClient(std::string path);
+	~SolverClient();
+	bool is_connected() const;
+	bool solve(const std::vector<SolveRequest> &requests, std::vector<SolveResult> &results);
+	bool stop_service();
+};
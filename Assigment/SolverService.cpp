@@ -0,0 +1,523 @@
+/**
+* \file      SolverService.cpp
+* \author    m.leclech
+* \version   1.0
+* \date      19 October 2026
+* \brief     Local solver service, listening on a Unix domain socket.
+*
+* \details   See SolverService.h for the description of the protocol.
+*            The service is only available on POSIX systems.
+*/
+
+#include "SolverService.h"
+#include <iostream>
+#include <future>
+#include <memory>
+#include <algorithm>
+#include <numeric>
+#include <exception>
+
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+#endif
+
+const unsigned int MAX_JOBS = 1 << 16; //!< maximum number of jobs in a batch
+const unsigned int MAX_TIMES = 1 << 16; //!< maximum number of output times in a job
+const int MAX_SPACE_STEPS = 1 << 24; //!< maximum number of space steps of a job
+const unsigned int MAX_WORKSPACE = 16; //!< maximum number of problems kept by a worker
+
+//
+// ...... PROTOCOL ......
+//
+
+/**
+* \fn bool read_all(int fd, void *buffer, unsigned int size)
+* \brief Read exactly size bytes from a socket
+*
+* \param fd - the socket
+* \param buffer - where the bytes are stored
+* \param size - the number of bytes to read
+* \return ok - false if the connection was closed or failed
+*/
+bool read_all(int fd, void *buffer, unsigned int size){
+#ifndef _WIN32
+	char *position = (char*)buffer;
+	while (size > 0){
+		ssize_t count = recv(fd, position, size, 0);
+		if (count < 0 && errno == EINTR){
+			continue;
+		}
+		if (count <= 0){
+			return false;
+		}
+		position += count;
+		size -= (unsigned int)count;
+	}
+	return true;
+#else
+	return false;
+#endif
+}
+
+/**
+* \fn bool write_all(int fd, const void *buffer, unsigned int size)
+* \brief Write exactly size bytes on a socket
+*
+* \param fd - the socket
+* \param buffer - the bytes to write
+* \param size - the number of bytes to write
+* \return ok - false if the connection was closed or failed
+*/
+bool write_all(int fd, const void *buffer, unsigned int size){
+#ifndef _WIN32
+	const char *position = (const char*)buffer;
+	while (size > 0){
+		ssize_t count = send(fd, position, size, MSG_NOSIGNAL);
+		if (count < 0 && errno == EINTR){
+			continue;
+		}
+		if (count <= 0){
+			return false;
+		}
+		position += count;
+		size -= (unsigned int)count;
+	}
+	return true;
+#else
+	return false;
+#endif
+}
+
+/**
+* \fn bool read_request(int fd, SolveRequest &request)
+* \brief Read one job of a batch
+*
+* \param fd - the socket
+* \param request - where the job is stored
+* \return ok - false if the connection failed or the job is too big
+*/
+bool read_request(int fd, SolveRequest &request){
+	double parameters[7];
+	unsigned int size = 0;
+	if (!read_all(fd, &request.scheme, sizeof(request.scheme)) || !read_all(fd, parameters, sizeof(parameters)) || !read_all(fd, &size, sizeof(size))){
+		return false;
+	}
+	if (size > MAX_TIMES){
+		return false;
+	}
+	request.Tin_0 = parameters[0];
+	request.Text_0 = parameters[1];
+	request.Xmin = parameters[2];
+	request.Xmax = parameters[3];
+	request.D = parameters[4];
+	request.dx = parameters[5];
+	request.dt = parameters[6];
+	request.times = std::vector<double>(size);
+	return size == 0 || read_all(fd, &request.times[0], size * sizeof(double));
+}
+
+/**
+* \fn bool write_request(int fd, const SolveRequest &request)
+* \brief Write one job of a batch
+*
+* \param fd - the socket
+* \param request - the job to send
+* \return ok - false if the connection failed
+*/
+bool write_request(int fd, const SolveRequest &request){
+	double parameters[7] = { request.Tin_0, request.Text_0, request.Xmin, request.Xmax, request.D, request.dx, request.dt };
+	unsigned int size = request.times.size();
+	if (!write_all(fd, &request.scheme, sizeof(request.scheme)) || !write_all(fd, parameters, sizeof(parameters)) || !write_all(fd, &size, sizeof(size))){
+		return false;
+	}
+	return size == 0 || write_all(fd, &request.times[0], size * sizeof(double));
+}
+
+/**
+* \fn bool read_result(int fd, const SolveRequest &request, SolveResult &result)
+* \brief Read the answer to one job
+*
+* \param fd - the socket
+* \param request - the job sent, which give the number of output times
+* \param result - where the answer is stored
+* \return ok - false if the connection failed
+*/
+bool read_result(int fd, const SolveRequest &request, SolveResult &result){
+	if (!read_all(fd, &result.status, sizeof(result.status))){
+		return false;
+	}
+	result.solutions.clear();
+	if (result.status != SERVICE_OK){
+		return true;
+	}
+	for (int i = 0; i < int(request.times.size()); i++){
+		unsigned int size = 0;
+		if (!read_all(fd, &size, sizeof(size)) || size > (unsigned int)(MAX_SPACE_STEPS + 1)){
+			return false;
+		}
+		std::vector<double> solution(size);
+		if (size > 0 && !read_all(fd, &solution[0], size * sizeof(double))){
+			return false;
+		}
+		result.solutions.push_back(solution);
+	}
+	return true;
+}
+
+/**
+* \fn bool write_result(int fd, const SolveResult &result)
+* \brief Write the answer to one job
+*
+* \param fd - the socket
+* \param result - the answer to send
+* \return ok - false if the connection failed
+*/
+bool write_result(int fd, const SolveResult &result){
+	if (!write_all(fd, &result.status, sizeof(result.status))){
+		return false;
+	}
+	for (int i = 0; i < int(result.solutions.size()); i++){
+		unsigned int size = result.solutions[i].size();
+		if (!write_all(fd, &size, sizeof(size))){
+			return false;
+		}
+		if (size > 0 && !write_all(fd, &result.solutions[i][0], size * sizeof(double))){
+			return false;
+		}
+	}
+	return true;
+}
+
+//
+// ...... WORKSPACE ......
+//
+
+/**
+* \fn Workspace::Workspace()
+* \brief Constructor of the Workspace class, empty
+*/
+Workspace::Workspace() {}
+
+/**
+* \fn Workspace::~Workspace()
+* \brief Destructor of the Workspace class, which delete the problems
+*/
+Workspace::~Workspace(){
+	clear();
+}
+
+/**
+* \fn HeatConduction* Workspace::get_problem(const SolveRequest &request, double Tend)
+* \brief Problem of the scheme and the grid of a job, created the first time and then set with the parameters of the job
+*
+* \param request - the job
+* \param Tend - the end time of the simulation
+* \return problem - owned by the workspace, or nullptr if the scheme is unknown
+*/
+HeatConduction* Workspace::get_problem(const SolveRequest &request, double Tend){
+	std::pair<int, int> key(request.scheme, int((request.Xmax - request.Xmin) / request.dx));
+	std::map<std::pair<int, int>, HeatConduction*>::iterator found = problems.find(key);
+	if (found != problems.end()){
+		(*found->second).set_parameters(request.Tin_0, request.Text_0, request.Xmin, request.Xmax, Tend, request.D, request.dx, request.dt);
+		return found->second;
+	}
+	if (problems.size() >= MAX_WORKSPACE){
+		clear(); // a client using many grids does not make the worker keep all of them
+	}
+	HeatConduction *problem = create_problem(request.scheme, request.Tin_0, request.Text_0, request.Xmin, request.Xmax, Tend, request.D, request.dx, request.dt);
+	if (problem != nullptr){
+		problems[key] = problem;
+	}
+	return problem;
+}
+
+/**
+* \fn void Workspace::clear()
+* \brief Delete all the problems
+*
+* \return void
+*/
+void Workspace::clear(){
+	for (std::map<std::pair<int, int>, HeatConduction*>::iterator it = problems.begin(); it != problems.end(); ++it){
+		delete it->second;
+	}
+	problems.clear();
+}
+
+//
+// ...... SERVICE ......
+//
+
+/**
+* \fn SolverService::SolverService(std::string path, int threads, unsigned int capacity, std::string directory)
+* \brief Constructor of the SolverService class, which start the pool of workers
+*
+* \param path - the path of the Unix domain socket
+* \param threads - the number of workers
+* \param capacity - the number of solutions kept in memory by the cache
+* \param directory - the directory of the disk tier of the cache, empty if not used
+*/
+SolverService::SolverService(std::string path, int threads, unsigned int capacity, std::string directory) : cache(capacity, directory) {
+	this->path = path;
+	listener = -1;
+	stopping = false;
+	closing = false;
+	connections = 0;
+	if (threads < 1){
+		threads = 1;
+	}
+	for (int i = 0; i < threads; i++){
+		workers.push_back(std::thread(&SolverService::work, this));
+	}
+}
+
+/**
+* \fn SolverService::~SolverService()
+* \brief Destructor of the SolverService class, which wait for the workers
+*/
+SolverService::~SolverService(){
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		closing = true;
+	}
+	available.notify_all();
+	for (int i = 0; i < int(workers.size()); i++){
+		workers[i].join();
+	}
+}
+
+/**
+* \fn void SolverService::work()
+* \brief Loop of a worker : take the tasks one by one until the service is closed, with the same Workspace
+*
+* \return void
+*/
+void SolverService::work(){
+	Workspace workspace;
+	while (true){
+		std::function<void(Workspace&)> task;
+		{
+			std::unique_lock<std::mutex> guard(lock);
+			while (!closing && tasks.empty()){
+				available.wait(guard);
+			}
+			if (tasks.empty()){
+				return;
+			}
+			task = tasks.front();
+			tasks.pop();
+		}
+		task(workspace);
+	}
+}
+
+/**
+* \fn SolveResult SolverService::run_job(const SolveRequest &request, Workspace &workspace)
+* \brief Solve one job at all its output times, through the cache
+*
+* The output times are solved in increasing order with one march from t = 0, and a
+* snapshot of the solution is taken at each of them. The times already in the cache
+* are not solved again, and the march stop at the last time which is not.
+*
+* \param request - the job to solve
+* \param workspace - the problems of the worker
+* \return result - SERVICE_INVALID if the scheme or the parameters are wrong, or if the job failed (e.g. out of memory)
+*/
+SolveResult SolverService::run_job(const SolveRequest &request, Workspace &workspace){
+	SolveResult result;
+	result.status = SERVICE_INVALID;
+
+	if (!(request.dx > 0) || !(request.dt > 0) || !(request.Xmax > request.Xmin)){
+		return result;
+	}
+	double steps = (request.Xmax - request.Xmin) / request.dx;
+	if (steps < 2 || steps > MAX_SPACE_STEPS){
+		return result;
+	}
+	for (int i = 0; i < int(request.times.size()); i++){
+		if (!(request.times[i] >= 0) || request.times[i] / request.dt > 2e9){
+			return result;
+		}
+	}
+	if (request.scheme < ANALYTICAL || request.scheme > CRANK_NICHOLSON){
+		return result;
+	}
+
+	std::vector<int> order(request.times.size());
+	std::iota(order.begin(), order.end(), 0);
+	std::stable_sort(order.begin(), order.end(), [&request](int i, int j){ return request.times[i] < request.times[j]; });
+	try {
+		result.solutions = std::vector<std::vector<double> >(request.times.size());
+		int done = -1; // time step reached by the march, -1 before the initialisation
+		for (int k = 0; k < int(order.size()); k++){
+			HeatConduction *problem = workspace.get_problem(request, request.times[order[k]]);
+			std::string key = (*problem).get_key();
+			std::vector<double> &solution = result.solutions[order[k]];
+			if (cache.find(key, (*problem).get_s() + 1, solution)){
+				continue;
+			}
+			if (request.scheme == ANALYTICAL){
+				(*problem).solve();
+			}
+			else {
+				if (done < 0){
+					(*problem).initialise();
+					done = 0;
+				}
+				(*problem).march((*problem).get_n() - done);
+				done = (*problem).get_n();
+			}
+			solution = (*problem).get_u_n();
+			cache.add(key, solution);
+		}
+	}
+	catch (const std::exception &error){
+		std::cerr << "Job failed: " << error.what() << std::endl;
+		workspace.clear(); // a problem may be left half allocated
+		result.solutions.clear();
+		return result;
+	}
+	result.status = SERVICE_OK;
+	return result;
+}
+
+/**
+* \fn void SolverService::serve(int connection)
+* \brief Read the batches of a connection, schedule their jobs and send back the results
+*
+* \param connection - the socket of the client, closed at the end
+* \return void
+*/
+void SolverService::serve(int connection){
+#ifndef _WIN32
+	unsigned int op = 0;
+	while (read_all(connection, &op, sizeof(op))){
+		if (op == SERVICE_STOP){
+			std::lock_guard<std::mutex> guard(lock);
+			stopping = true;
+			shutdown(listener, SHUT_RDWR); // wake up accept
+			for (std::set<int>::iterator it = sockets.begin(); it != sockets.end(); ++it){
+				shutdown(*it, SHUT_RD); // the idle connections stop waiting, the busy ones finish their batch
+			}
+			break;
+		}
+
+		unsigned int size = 0;
+		if (op != SERVICE_SOLVE || !read_all(connection, &size, sizeof(size)) || size > MAX_JOBS){
+			break;
+		}
+		std::vector<SolveRequest> requests(size);
+		bool ok = true;
+		for (int i = 0; i < int(size) && ok; i++){
+			ok = read_request(connection, requests[i]);
+		}
+		if (!ok){
+			break;
+		}
+
+		// all the jobs are scheduled before waiting for the first one
+		std::vector<std::future<SolveResult> > results;
+		for (int i = 0; i < int(size); i++){
+			std::shared_ptr<std::packaged_task<SolveResult(Workspace&)> > task(new std::packaged_task<SolveResult(Workspace&)>(std::bind(&SolverService::run_job, this, requests[i], std::placeholders::_1)));
+			results.push_back(task->get_future());
+			{
+				std::lock_guard<std::mutex> guard(lock);
+				tasks.push([task](Workspace &workspace){ (*task)(workspace); });
+			}
+			available.notify_one();
+		}
+
+		// the results are streamed in the order of the batch
+		for (int i = 0; i < int(size) && ok; i++){
+			ok = write_result(connection, results[i].get());
+		}
+		if (!ok){
+			break;
+		}
+	}
+	std::lock_guard<std::mutex> guard(lock);
+	sockets.erase(connection);
+	close(connection);
+	connections--;
+	closed.notify_all();
+#endif
+}
+
+/**
+* \fn int SolverService::run()
+* \brief Listen on the socket until a SERVICE_STOP is received
+*
+* \return code - 0 if the service stopped normally, 1 if the socket could not be opened
+*/
+int SolverService::run(){
+#ifndef _WIN32
+	sockaddr_un address;
+	memset(&address, 0, sizeof(address));
+	address.sun_family = AF_UNIX;
+	if (path.size() >= sizeof(address.sun_path)){
+		std::cerr << "Socket path too long: " << path << std::endl;
+		return 1;
+	}
+	strcpy(address.sun_path, path.c_str());
+
+	listener = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (listener < 0){
+		std::cerr << "Cannot create the socket: " << strerror(errno) << std::endl;
+		return 1;
+	}
+	unlink(path.c_str());
+	if (bind(listener, (sockaddr*)&address, sizeof(address)) < 0 || listen(listener, 16) < 0){
+		std::cerr << "Cannot listen on " << path << ": " << strerror(errno) << std::endl;
+		close(listener);
+		return 1;
+	}
+
+	while (true){
+		int connection = accept(listener, nullptr, nullptr);
+		std::lock_guard<std::mutex> guard(lock);
+		if (stopping){
+			if (connection >= 0){
+				close(connection);
+			}
+			break;
+		}
+		if (connection < 0){
+			continue;
+		}
+		connections++;
+		sockets.insert(connection);
+		std::thread(&SolverService::serve, this, connection).detach();
+	}
+
+	{
+		std::unique_lock<std::mutex> guard(lock);
+		while (connections > 0){
+			closed.wait(guard);
+		}
+	}
+	close(listener);
+	unlink(path.c_str());
+	return 0;
+#else
+	std::cerr << "The solver service needs Unix domain sockets, it is not available on Windows" << std::endl;
+	return 1;
+#endif
+}
+
+/**
+* \fn const ResultCache& SolverService::get_cache() const
+* \brief Get method of the attribute cache, to read its statistics
+*
+* \return cache - the cache shared by the workers
+*/
+const ResultCache& SolverService::get_cache() const {
+	return cache;
+}
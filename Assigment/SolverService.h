@@ -0,0 +1,121 @@
+/**
+* \file      SolverService.h
+* \author    m.leclech
+* \version   1.0
+* \date      19 October 2026
+* \brief     Local solver service, listening on a Unix domain socket.
+*
+* \details   The service keeps running between the studies, so the solutions
+*            already calculated are kept in its ResultCache. The protocol is binary,
+*            with the native byte order since client and service run on the same machine :
+*              - request : uint32 op, then for SERVICE_SOLVE an uint32 number of jobs and
+*                for each job an int32 scheme, 7 doubles (Tin_0, Text_0, Xmin, Xmax, D, dx, dt),
+*                an uint32 number of output times and the output times
+*              - response : for each job, in the order of the request, an int32 status,
+*                then if the status is SERVICE_OK, for each output time an uint32 size and the solution
+*            A connection can send several batches before being closed.
+*            The service is only available on POSIX systems.
+*/
+
+#pragma once
+
+#include "ResultCache.h"
+#include <vector>
+#include <string>
+#include <queue>
+#include <map>
+#include <set>
+#include <utility>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+const unsigned int SERVICE_SOLVE = 1; //!< op of a batch of jobs
+const unsigned int SERVICE_STOP = 2; //!< op to stop the service
+const int SERVICE_OK = 0; //!< status of a job solved
+const int SERVICE_INVALID = 1; //!< status of a job with an unknown scheme or wrong parameters
+
+/**
+* \struct SolveRequest
+* \brief One job of a batch : a scheme, its parameters and the times at which the solution is needed
+*/
+struct SolveRequest {
+	int scheme; //!< a value of the enum Scheme
+	double Tin_0; //!< initial condition Temperature inside
+	double Text_0; //!< initial condition Temperature outside
+	double Xmin; //!< the X position far left
+	double Xmax; //!< the X position far right
+	double D; //!< the difusivity of the wall
+	double dx; //!< the space step
+	double dt; //!< the time step
+	std::vector<double> times; //!< output times, each one is a Tend
+};
+
+/**
+* \struct SolveResult
+* \brief Answer to one job : its status and one solution per output time
+*/
+struct SolveResult {
+	int status; //!< SERVICE_OK or SERVICE_INVALID
+	std::vector<std::vector<double> > solutions; //!< solution at each output time
+};
+
+/**
+* \class Workspace
+* \brief Problems kept by a worker between the jobs, one per scheme and number of space steps
+*
+* The vectors of a problem are used again by the next job with the same scheme and
+* the same grid, so a warm worker does not allocate.
+*/
+class Workspace {
+private:
+	std::map<std::pair<int, int>, HeatConduction*> problems; //!< problem of each scheme and number of space steps
+public:
+	Workspace();
+	Workspace(const Workspace&) = delete;
+	Workspace& operator=(const Workspace&) = delete;
+	~Workspace();
+	HeatConduction* get_problem(const SolveRequest &request, double Tend);
+	void clear();
+};
+
+/**
+* \class SolverService
+* \brief Daemon which solve the batches sent on a Unix domain socket
+*
+* Each connection is read by its own thread, and the jobs of a batch are scheduled
+* on a pool of workers, each one with its own Workspace. The results are sent back as
+* soon as they are ready, in the order of the batch. All the workers share the same
+* ResultCache.
+*/
+class SolverService {
+private:
+	std::string path; //!< path of the socket
+	int listener; //!< file descriptor of the listening socket
+	bool stopping; //!< true once a SERVICE_STOP is received
+	bool closing; //!< true when the workers have to finish
+	int connections; //!< number of connections still open
+	std::set<int> sockets; //!< sockets of the connections still open, shut down on stop
+	std::vector<std::thread> workers; //!< pool of threads solving the jobs
+	std::queue<std::function<void(Workspace&)> > tasks; //!< jobs waiting for a worker
+	std::mutex lock; //!< protect tasks, connections and the flags
+	std::condition_variable available; //!< signal a new task or the closing
+	std::condition_variable closed; //!< signal the end of a connection
+	ResultCache cache; //!< solutions kept warm between requests
+	void work();
+	void serve(int connection);
+	SolveResult run_job(const SolveRequest &request, Workspace &workspace);
+public:
+	SolverService(std::string path, int threads, unsigned int capacity = 256, std::string directory = "");
+	~SolverService();
+	int run();
+	const ResultCache& get_cache() const;
+};
+
+bool read_all(int fd, void *buffer, unsigned int size);
+bool write_all(int fd, const void *buffer, unsigned int size);
+bool read_request(int fd, SolveRequest &request);
+bool write_request(int fd, const SolveRequest &request);
+bool read_result(int fd, const SolveRequest &request, SolveResult &result);
+bool write_result(int fd, const SolveResult &result);
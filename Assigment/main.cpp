@@ -1,13 +1,25 @@
 #include "HeatConduction.h"
 #include "Norms.h"
+#include "ResultCache.h"
+#include "SolverService.h"
+#include "SolverClient.h"
+#include "SchemeSelector.h"
+#include "Parareal.h"
 #include <fstream>
 #include <iostream>
 #include <iomanip>
 #include <sstream>
 #include <chrono>
+#include <thread>
+#include <cstring>
+#include <cstdlib>
+#include <cmath>
+#include <algorithm>
 
 typedef std::chrono::high_resolution_clock Clock;
 
+ResultCache cache(32); //!< solutions already calculated, shared by all the studies
+
 //
 // ...... DEMONSTRATION OF THE USE OF THE DIFFERENT CLASSES ......
 //
@@ -37,23 +49,23 @@ void assigment(double Tend){
 	// creation of all the object corresponding to the different methods
 	HeatConduction *problemAN;
 	problemAN = new AnalyticalSolution(Tin_0, Text_0, Xmin, Xmax, Tend, D, dx, dt);
-	(*problemAN).solve();
+	cache.solve(*problemAN);
 
 	HeatConduction *problemDFF;
 	problemDFF = new DuFort_Frankel(Tin_0, Text_0, Xmin, Xmax, Tend, D, dx, dt);
-	(*problemDFF).solve();
+	cache.solve(*problemDFF);
 
 	HeatConduction *problemRI;
 	problemRI = new Richardson(Tin_0, Text_0, Xmin, Xmax, Tend, D, dx, dt);
-	(*problemRI).solve();
+	cache.solve(*problemRI);
 
 	HeatConduction *problemLSI;
 	problemLSI = new Laasonen(Tin_0, Text_0, Xmin, Xmax, Tend, D, dx, dt);
-	(*problemLSI).solve();
+	cache.solve(*problemLSI);
 
 	HeatConduction *problemCN;
 	problemCN = new CrankNicholson(Tin_0, Text_0, Xmin, Xmax, Tend, D, dx, dt);
-	(*problemCN).solve();
+	cache.solve(*problemCN);
 
 	// creation of the different files to store the data
 	std::string TendS = std::to_string(Tend);
@@ -144,11 +156,11 @@ void LassWithDifferentDT(double dt){
 	// creation of all the object corresponding to the different methods
 	HeatConduction *problemAN;
 	problemAN = new AnalyticalSolution(Tin_0, Text_0, Xmin, Xmax, Tend, D, dx, dt);
-	(*problemAN).solve();
+	cache.solve(*problemAN);
 
 	HeatConduction *problemLSI;
 	problemLSI = new Laasonen(Tin_0, Text_0, Xmin, Xmax, Tend, D, dx, dt);
-	(*problemLSI).solve();
+	cache.solve(*problemLSI);
 
 	// creation of the file to store the data
 	std::string dtS = std::to_string(dt);
@@ -187,13 +199,232 @@ void LassWithDifferentDT(double dt){
 }
 
 /**
-* \fn int main()
+* \fn int client(std::string path, int scheme, double dt, std::vector<double> times)
+* \brief Function to solve the problem of the assigment through a running solver service
+*
+* \param path - the path of the socket of the service
+* \param scheme - a value of the enum Scheme
+* \param dt - the time step
+* \param times - the times at which the solution is printed
+* \return 0 - return a 0 if everything went ok.
+*/
+int client(std::string path, int scheme, double dt, std::vector<double> times){
+	SolveRequest request;
+	request.scheme = scheme;
+	request.Tin_0 = 100;
+	request.Text_0 = 300;
+	request.Xmin = 0;
+	request.Xmax = 1;
+	request.D = 0.1;
+	request.dx = 0.05;
+	request.dt = dt;
+	request.times = times;
+
+	SolverClient solverClient(path);
+	std::vector<SolveResult> results;
+	if (!solverClient.solve(std::vector<SolveRequest>(1, request), results)){
+		std::cerr << "Cannot reach the service on " << path << std::endl;
+		return 1;
+	}
+	if (results[0].status != SERVICE_OK){
+		std::cerr << "Invalid scheme or parameters" << std::endl;
+		return 1;
+	}
+
+	// same format as the files : position and solution, one block per time
+	std::cout << std::fixed << std::setprecision(6);
+	for (int t = 0; t < int(times.size()); t++){
+		std::cout << "# " << times[t] << "\n";
+		double x = request.Xmin;
+		for (int i = 0; i < int(results[0].solutions[t].size()); i++){
+			std::cout << x << " " << results[0].solutions[t][i] << "\n";
+			x += request.dx;
+		}
+	}
+	return 0;
+}
+
+/**
+* \fn int select(double target, int norm, double Tend)
+* \brief Function to choose the scheme, dt and dx for the problem of the assigment, and print the predicted and achieved results
+*
+* \param target - the largest error allowed
+* \param norm - a value of the enum Norm
+* \param Tend - the time at which the simulation end (in hours)
+* \return 0 - return a 0 if a scheme reach the target, a 1 if not or if the arguments are wrong.
+*/
+int select(double target, int norm, double Tend){
+	if (!(target > 0) || !(Tend > 0) || norm < NORM_ONE || norm > NORM_UNIFORM){
+		std::cerr << "The target and Tend must be positive, and the norm 0, 1 or 2" << std::endl;
+		return 1;
+	}
+	SchemeSelector selector(100, 300, 0, 1, Tend, 0.1, norm);
+	Selection selection = selector.select(target);
+	if (selection.found){
+		selector.run(selection);
+	}
+	std::cout << selection_report(selection, target);
+	return selection.found ? 0 : 1;
+}
+
+/**
+* \fn int parareal(int slices, double tolerance, double Tend, int workers)
+* \brief Function to solve the problem of the assigment with the Parareal algorithm, and print the iterations and the speedup
+*
+* The fine propagator is the Crank-Nicholson scheme with dt = 0.0001, the coarse one
+* the Laasonen scheme with dt = 0.05.
+*
+* \param slices - the number of time slices
+* \param tolerance - the largest correction of a slice to stop
+* \param Tend - the time at which the simulation end (in hours)
+* \param workers - the number of threads for the fine solves
+* \return 0 - return a 0 if the algorithm converged, a 1 if not or if the arguments are wrong.
+*/
+int parareal(int slices, double tolerance, double Tend, int workers){
+	if (slices < 1 || !(tolerance >= 0) || !(Tend > 0)){
+		std::cerr << "The slices must be at least 1, the tolerance positive or zero and Tend positive" << std::endl;
+		return 1;
+	}
+	Parareal solver(100, 300, 0, 1, Tend, 0.1, 0.05, 0.0001, 0.05, slices, workers);
+	PararealResult result = solver.solve(tolerance, solver.get_slices());
+	solver.compare(result);
+	std::cout << parareal_report(result, solver.get_slices());
+	return result.converged ? 0 : 1;
+}
+
+/**
+* \fn bool same_solution(const char *name, const std::vector<double> &solution, const std::vector<double> &expected)
+* \brief Compare two solutions to the last bit, and print the result of the comparison
+*
+* \param name - the name of the check, printed
+* \param solution - the solution checked
+* \param expected - the solution expected
+* \return same - true if the solutions are identical
+*/
+bool same_solution(const char *name, const std::vector<double> &solution, const std::vector<double> &expected){
+	double difference = 0;
+	for (int i = 0; i < int(solution.size()) && i < int(expected.size()); i++){
+		difference = std::max(difference, std::fabs(solution[i] - expected[i]));
+	}
+	bool same = (solution == expected);
+	std::cout << (same ? "ok     " : "FAILED ") << name << " // max difference " << difference << std::endl;
+	return same;
+}
+
+/**
+* \fn int check()
+* \brief Function to check that the classes give the same solution whatever the path used
+*
+* For each implicit scheme of the assigment :
+*   - a problem already solved and given to a ResultCache, which has to solve it again from t = 0
+*   - a solution found in the cache, which has to leave the problem as a solve does
+* For each scheme, with the schemes specialized on s and without :
+*   - a solve continued by march, which has to give the solve of the longer simulation
+*
+* \return 0 - return a 0 if all the checks passed.
+*/
+int check(){
+	bool passed = true;
+	for (int scheme = LAASONEN; scheme <= CRANK_NICHOLSON; scheme++){
+		HeatConduction *expected = create_problem(scheme, 100, 300, 0, 1, 0.5, 0.1, 0.05, 0.01);
+		(*expected).solve();
+		std::cout << (*expected).get_scheme() << std::endl;
+
+		// a miss on a problem already solved must not store the solution at 2*Tend
+		ResultCache checkCache(4);
+		HeatConduction *solved = create_problem(scheme, 100, 300, 0, 1, 0.5, 0.1, 0.05, 0.01);
+		(*solved).solve();
+		checkCache.solve(*solved);
+		passed &= same_solution("cache miss on a solved problem", (*solved).get_u_n(), (*expected).get_u_n());
+		HeatConduction *fresh = create_problem(scheme, 100, 300, 0, 1, 0.5, 0.1, 0.05, 0.01);
+		checkCache.solve(*fresh);
+		passed &= same_solution("cache hit after it", (*fresh).get_u_n(), (*expected).get_u_n());
+
+		// after a hit or a miss the problem is in the same state, so a second solve give the same result
+		bool sameState = ((*fresh).is_modified() == (*solved).is_modified());
+		std::cout << (sameState ? "ok     " : "FAILED ") << "same state after a hit and a miss" << std::endl;
+		passed &= sameState;
+		checkCache.solve(*solved);
+		checkCache.solve(*fresh);
+		passed &= same_solution("second cache solve after a hit and a miss", (*fresh).get_u_n(), (*solved).get_u_n());
+
+		delete expected;
+		delete solved;
+		delete fresh;
+	}
+
+	bool fixedSize = HeatConduction::get_fixed_size();
+	for (int fixed = 0; fixed < 2; fixed++){
+		HeatConduction::set_fixed_size(fixed == 1);
+		for (int scheme = DUFORT_FRANKEL; scheme <= CRANK_NICHOLSON; scheme++){
+			HeatConduction *longer = create_problem(scheme, 100, 300, 0, 1, 0.6, 0.1, 0.05, 0.01);
+			(*longer).solve();
+			HeatConduction *continued = create_problem(scheme, 100, 300, 0, 1, 0.5, 0.1, 0.05, 0.01);
+			(*continued).solve();
+			(*continued).march((*longer).get_n() - (*continued).get_n());
+			std::cout << (*continued).get_scheme() << (fixed == 1 ? " specialized on s" : " generic") << std::endl;
+			passed &= same_solution("solve continued by march", (*continued).get_u_n(), (*longer).get_u_n());
+			delete longer;
+			delete continued;
+		}
+	}
+	HeatConduction::set_fixed_size(fixedSize);
+
+	std::cout << (passed ? "All the checks passed" : "Some checks failed") << std::endl;
+	return passed ? 0 : 1;
+}
+
+/**
+* \fn int main(int argc, char *argv[])
 * \brief Function to launch the 2 other fonctions of the main with differents arguments 
 *
-* \param none
+* Without argument the assigment is calculated and the files are printed. Other modes are available :
+*   - --daemon [socket path] [workers] : run the solver service until a client stop it
+*   - --client socket_path scheme dt time... : solve through a running service and print the solutions
+*   - --stop [socket path] : stop a running service
+*   - --select target [norm] [Tend] : choose the cheapest scheme, dt and dx for the assigment with an error below the target
+*   - --parareal slices tolerance [Tend] [workers] : solve the assigment with the Parareal algorithm and compare it with the serial solve
+*   - --check : check that the classes and the cache give the same solution whatever the path used
+*
+* \param argc - number of arguments
+* \param argv - the mode and its arguments
 * \return 0 - return a 0 if everything went ok.
 */
-int main(){
+int main(int argc, char *argv[]){
+	if (argc > 1 && strcmp(argv[1], "--daemon") == 0){
+		std::string path = argc > 2 ? argv[2] : "/tmp/heatconduction.sock";
+		int workers = argc > 3 ? atoi(argv[3]) : int(std::thread::hardware_concurrency());
+		SolverService service(path, workers);
+		return service.run();
+	}
+	if (argc > 1 && strcmp(argv[1], "--stop") == 0){
+		SolverClient solverClient(argc > 2 ? argv[2] : "/tmp/heatconduction.sock");
+		return solverClient.stop_service() ? 0 : 1;
+	}
+	if (argc > 5 && strcmp(argv[1], "--client") == 0){
+		std::vector<double> times;
+		for (int i = 5; i < argc; i++){
+			times.push_back(atof(argv[i]));
+		}
+		return client(argv[2], atoi(argv[3]), atof(argv[4]), times);
+	}
+
+	if (argc > 2 && strcmp(argv[1], "--select") == 0){
+		int norm = argc > 3 ? atoi(argv[3]) : NORM_UNIFORM;
+		double Tend = argc > 4 ? atof(argv[4]) : 0.5;
+		return select(atof(argv[2]), norm, Tend);
+	}
+
+	if (argc > 1 && strcmp(argv[1], "--check") == 0){
+		return check();
+	}
+
+	if (argc > 3 && strcmp(argv[1], "--parareal") == 0){
+		double Tend = argc > 4 ? atof(argv[4]) : 5;
+		int workers = argc > 5 ? atoi(argv[5]) : int(std::thread::hardware_concurrency());
+		return parareal(atoi(argv[2]), atof(argv[3]), Tend, workers);
+	}
+
 	// clear the two files norms and normsLaas at each new launch of the program
 	std::ofstream norms;
 	std::ofstream norms1;
@@ -214,6 +445,8 @@ int main(){
 		std::cout << "Delta t2-t1: " << std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count() << " nanoseconds" << std::endl;
 	}
 
+	std::cout << "Cache: " << cache.get_hits() << " hits // " << cache.get_misses() << " misses" << std::endl;
+
 	system("PAUSE");
 	return 0;
 }
\ No newline at end of file
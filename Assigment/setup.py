@@ -0,0 +1,28 @@
+# -*- coding: utf-8 -*-
+"""
+Build of the Python module heatconduction :
+    pip install ./Assigment
+or, to build it in place next to plot.py :
+    python setup.py build_ext --inplace
+
+@author: m.leclech
+"""
+
+import sys
+import numpy
+from setuptools import setup, Extension
+
+module = Extension(
+    "heatconduction",
+    ["HeatConductionPython.cpp", "HeatConduction.cpp", "Norms.cpp", "ResultCache.cpp", "FixedSizeSchemes.cpp"],
+    include_dirs=[numpy.get_include()],
+    extra_compile_args=[] if sys.platform == "win32" else ["-std=c++11"],
+)
+
+setup(
+    name="heatconduction",
+    version="1.0",
+    description="Heat Conduction problem of a wall, solved with 4 finite difference schemes",
+    ext_modules=[module],
+    install_requires=["numpy"],
+)